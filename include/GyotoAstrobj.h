@@ -43,6 +43,7 @@ namespace Gyoto{
   class Photon;
   namespace Register { class Entry; }
   namespace Metric { class Generic; }
+  namespace Functor { class Double_constDoubleArray; }
   class FactoryMessenger;
   namespace Astrobj {
     class Generic;
@@ -231,6 +232,14 @@ class Gyoto::Astrobj::Generic : protected Gyoto::SmartPointee {
 
   int flag_radtransf_; ///< 1 if radiative transfer inside Astrobj, else 0
 
+  /**
+   * If not NULL, Generic::processHitQuantities() takes
+   * *hit_emission_ as the value of emission() at the observed
+   * frequency instead of calling it. Standard::Impact() sets it
+   * around each call when it already knows that value.
+   */
+  double const * hit_emission_; ///< Precomputed emission(), or NULL
+
   // Constructors - Destructor
   // -------------------------
  public:
@@ -357,6 +366,16 @@ class Gyoto::Astrobj::Generic : protected Gyoto::SmartPointee {
   virtual Quantity_t getDefaultQuantities();
   ///< Which quantities to compute if know was requested
 
+  /**
+   * Bitwise OR of GYOTO_SYMMETRY_* flags describing discrete
+   * symmetries of the object, including its emission and velocity
+   * field. The default (0) is always safe. Scenery uses this,
+   * together with Metric::Generic::getSymmetries() and
+   * Screen::getMirror(), to avoid tracing mirror-image photons.
+   */
+  virtual int getSymmetries() const;
+  ///< Symmetries of the object
+
   //XML I/O
  public:
   /**
@@ -462,6 +481,23 @@ class Gyoto::Astrobj::Generic : protected Gyoto::SmartPointee {
   virtual int Impact(Gyoto::Photon* ph, size_t index,
 		     Astrobj::Properties *data=NULL) = 0 ;
   ///< Does a photon at these coordinates impact the object?
+
+  /**
+   * \brief Surface function for integrator events
+   *
+   * An object whose surface is the level set f(coord)==value of a
+   * function of the coordinates may return this function here and
+   * set value. Photon::hit() then watches the sign of f-value at
+   * each integration step and Impact() can retrieve the date of a
+   * crossing with Photon::getEvent() instead of bisecting the step
+   * with Photon::findValue(). f<value is taken as the inside.
+   *
+   * The default implementation returns NULL (no event).
+   *
+   * \param[out] value level of the surface;
+   * \return the surface function or NULL.
+   */
+  virtual Functor::Double_constDoubleArray* getEventFunction(double &value);
   
   /**
    * \brief Fills Astrobj::Properties
@@ -679,6 +715,22 @@ class Gyoto::Astrobj::Properties : protected Gyoto::SmartPointee {
    */
   double * impactcoords; ///< GYOTO_QUANTITY_IMPACTCOORDS: ImpactCoords
 
+  /**
+   * Coordinates of the object and photon at each crossing of a thin
+   * disk, see Astrobj::ThinDisk::Impact(). Each pixel takes
+   * GYOTO_TRANSFER_SIZE doubles: GYOTO_TRANSFER_MAXCROSS records of
+   * GYOTO_TRANSFER_CROSSSIZE doubles (8 object coordinates, 8 photon
+   * coordinates, dt), in the order in which they were found. Unused
+   * records start with DBL_MAX.
+   */
+  double * transferfunction; ///< GYOTO_QUANTITY_TRANSFERFUNCTION: TransferFunction
+
+  /**
+   * Number of records already stored in transferfunction for the
+   * current pixel. Initialize it to 0.
+   */
+  size_t ncrossings; ///< Number of crossings in Properties::transferfunction
+
   /**
    * \brief GYOTO_QUANTITY_USER1       : User1
    * Astrobj-specific quantity
@@ -736,6 +788,9 @@ class Gyoto::Astrobj::Properties : protected Gyoto::SmartPointee {
    * - time, distance, first_dmin: DBL_MAX
    * - for spectrum and binspectrum, nbnuobs values separated by offset in memory are initialized to 0
    * - for impactcoords, 16 contiguous values are initialized to DBL_MAX
+   * - for transferfunction, the first value of each of the
+   *   GYOTO_TRANSFER_MAXCROSS records is initialized to DBL_MAX and
+   *   ncrossings to 0
    */
   void init(size_t nbnuobs=0);
 
@@ -743,7 +798,8 @@ class Gyoto::Astrobj::Properties : protected Gyoto::SmartPointee {
    * \brief Increment pointers
    *
    * All valid pointers are incremented by 1 (sizeof(double)), excepted
-   * impactcoords which is incremented by 16.
+   * impactcoords which is incremented by 16 and transferfunction
+   * which is incremented by GYOTO_TRANSFER_SIZE.
    */
   Properties operator++();
 # ifdef HAVE_UDUNITS
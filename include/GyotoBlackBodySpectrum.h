@@ -76,6 +76,55 @@ class Gyoto::Spectrum::BlackBody : public Gyoto::Spectrum::Generic {
   using Gyoto::Spectrum::Generic::operator();
   virtual double operator()(double nu) const;
 
+  /**
+   * \brief I<SUB>&nu;</SUB> at an explicit temperature
+   *
+   * Same as operator()(double nu) const, but for temperature T
+   * instead of T_. The object is not modified, so this can be used
+   * concurrently from several threads on a shared instance.
+   *
+   * \param nu frequency in Hz
+   * \param T temperature in K
+   */
+  double evaluate(double nu, double T) const;
+
+  /**
+   * \brief I<SUB>&nu;</SUB> at an explicit temperature for several frequencies
+   *
+   * Like evaluate(double nu, double T) const, looping on nbnu values
+   * of nu. The constant factors are computed only once.
+   *
+   * \param Inu[nbnu] output, must be allocated by the caller
+   * \param nu[nbnu] frequencies in Hz
+   * \param nbnu size of Inu[] and nu[]
+   * \param T temperature in K
+   */
+  void evaluate(double Inu[], double const nu[], size_t nbnu,
+		double T) const;
+
+  /**
+   * \brief Integrate I<SUB>&nu;</SUB> at an explicit temperature
+   *
+   * Like integrate(double nu1, double nu2), but for temperature T
+   * instead of T_, without modifying the object.
+   *
+   * \param nu1, nu2 boundaries for the integration
+   * \param T temperature in K
+   */
+  double integrate(double nu1, double nu2, double T) const;
+
+  using Gyoto::Spectrum::Generic::integrate;
+  /**
+   * \brief Integrate optically thick I<SUB>&nu;</SUB>
+   *
+   * Computed from the series expansions of the integral of
+   * x<SUP>3</SUP>/(exp(x)-1) (in Bernoulli numbers for small x, in
+   * exp(-kx) for large x) to machine precision, instead of the
+   * numerical integrator in Generic::integrate(double nu1, double
+   * nu2).
+   */
+  virtual double integrate(double nu1, double nu2);
+
 #ifdef GYOTO_USE_XERCES
   virtual void setParameter(std::string name,
 			    std::string content,
@@ -152,6 +152,9 @@ class Gyoto::Astrobj::Complex : public Gyoto::Astrobj::Generic {
 		     Astrobj::Properties *data=NULL)  ;
   ///< Call Impact() for each of the elements.
 
+  virtual int getSymmetries() const;
+  ///< Symmetries shared by all the elements.
+
 
   /**
    * This should work as expected:
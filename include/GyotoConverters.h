@@ -473,6 +473,8 @@ class Gyoto::Units::Converter : protected Gyoto::SmartPointee {
   friend class Gyoto::SmartPointer<Gyoto::Units::Converter>;
  private:
   cv_converter * converter_; ///< Underlying ut_converter object from udunits
+  bool linear_; ///< Whether the conversion is a mere scaling
+  double factor_; ///< Scaling factor, meaningful only if linear_
 
  public:
   Converter(); ///< Construct trivial Converter (Converter()(x)==x)
@@ -501,6 +503,32 @@ class Gyoto::Units::Converter : protected Gyoto::SmartPointee {
    * \return converted value expressed in Unit to
    */
   double operator()(double value) const ;
+
+  /**
+   * \brief Convert data in place
+   *
+   * Convert n values separated by stride doubles in memory. If the
+   * conversion is a mere scaling (see isLinear()), this is a simple
+   * multiplication by getFactor() and does not call udunits.
+   *
+   * \param values first value to convert
+   * \param n number of values to convert
+   * \param stride how to jump from one value to the next
+   */
+  void operator()(double * values, size_t n, size_t stride=1) const ;
+
+  /// Whether the conversion is a mere scaling
+  /**
+   * True if converting x yields getFactor()*x, as is the case for
+   * most physical units (but not e.g. for temperatures in &deg;C or
+   * for logarithmic units). Scaling conversions commute with
+   * summation: a sum of increments may be converted once instead of
+   * converting each increment.
+   */
+  bool isLinear() const ;
+
+  /// Scaling factor of a linear conversion, see isLinear()
+  double getFactor() const ;
 };
 
 #endif
@@ -91,6 +91,12 @@ namespace Gyoto {
    * A 16-element vector. See Gyoto::Quantity_t.
    */ 
 #define GYOTO_QUANTITY_IMPACTCOORDS  32
+  /// TransferFunction: Astrobj and Photon 8-coordinates at each disk crossing.
+  /**
+   * A GYOTO_TRANSFER_SIZE-element vector per pixel, filled by
+   * Astrobj::ThinDisk. See Astrobj::Properties::transferfunction.
+   */ 
+#define GYOTO_QUANTITY_TRANSFERFUNCTION 64
   /// Spectrum: I<SUB>&nu;</SUB> at each frequency in Scenery::screen_->getMidpoints().
 #define GYOTO_QUANTITY_SPECTRUM     512
   /// Spectrum: &int;<SUB>&nu;<SUB>1</SUB></SUB><SUP>&nu;<SUB>2</SUB></SUP>I<SUB>&nu;</SUB> d&nu; in each frequency channel in Scenery::screen_.
@@ -125,6 +131,40 @@ namespace Gyoto {
   /// Type for verbosity levels
   typedef unsigned int Verbosity_t;
 
+  /// Current debug mode
+  /**
+   * Read directly by #GYOTO_DEBUG_MODE so that a disabled debug
+   * statement costs a load and a branch, not a function call. Use
+   * Gyoto::debug(int mode) to change it.
+   */
+  extern int debug_mode_;
+
+  /// Current verbosity level
+  /**
+   * Read directly by #GYOTO_MSG and friends. Use Gyoto::verbose(int
+   * mode) to change it.
+   */
+  extern int verbosity_;
+
+  /// Branch prediction hint: x is expected to be false
+#if defined(__GNUC__)
+# define GYOTO_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+# define GYOTO_UNLIKELY(x) (x)
+#endif
+
+  /// Inline a function even where the compiler would not
+  /**
+   * Also lets a function be inlined in a caller compiled for a wider
+   * instruction set with the GCC target attribute, which then applies
+   * to the inlined code.
+   */
+#if defined(__GNUC__)
+# define GYOTO_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+# define GYOTO_ALWAYS_INLINE inline
+#endif
+
   /// Default debug mode
 #define GYOTO_DEFAULT_DEBUG_MODE 0
 
@@ -192,7 +232,8 @@ namespace Gyoto {
    * GYOTO_QUIET << "Important message displayed once" << std::endl;
    * \endcode
    */
-#define GYOTO_QUIET  if (Gyoto::verbose() >= GYOTO_QUIET_VERBOSITY) std::cout 
+#define GYOTO_QUIET						\
+  if (Gyoto::verbosity_ < GYOTO_QUIET_VERBOSITY) {} else std::cout
 
   /// Display a severe level message to stderr.
   /**
@@ -200,7 +241,9 @@ namespace Gyoto {
    * GYOTO_SEVERE << "Important warning" << std::endl;
    * \endcode
    */
-#define GYOTO_SEVERE if(Gyoto::verbose()>=GYOTO_SEVERE_VERBOSITY) std::cerr<<"SEVERE: "
+#define GYOTO_SEVERE						\
+  if (Gyoto::verbosity_ < GYOTO_SEVERE_VERBOSITY) {}		\
+  else std::cerr << "SEVERE: "
 
   /// Display a warning level message to stderr.
   /**
@@ -208,7 +251,9 @@ namespace Gyoto {
    * GYOTO_WARNING << "Warning" << std::endl;
    * \endcode
    */
-#define GYOTO_WARNING if(Gyoto::verbose()>=GYOTO_SEVERE_VERBOSITY) std::cerr<<"WARNING: "
+#define GYOTO_WARNING						\
+  if (Gyoto::verbosity_ < GYOTO_WARNING_VERBOSITY) {}		\
+  else std::cerr << "WARNING: "
 
   /// Display normal message to stdout.
   /**
@@ -219,7 +264,8 @@ namespace Gyoto {
    * GYOTO_MSG << "Message" << std::endl;
    * \endcode
    */
-#define GYOTO_MSG    if (Gyoto::verbose() >= GYOTO_DEFAULT_VERBOSITY) std::cout 
+#define GYOTO_MSG						\
+  if (Gyoto::verbosity_ < GYOTO_DEFAULT_VERBOSITY) {} else std::cout
 
   /// Display informative message to stderr.
   /**
@@ -227,10 +273,12 @@ namespace Gyoto {
    * been explicitely raised.
    *
    * \code
-   * GYOTO_MSG << "Message" << std::endl;
+   * GYOTO_INFO << "Message" << std::endl;
    * \endcode
    */
-#define GYOTO_INFO   if (Gyoto::verbose() >= GYOTO_INFO_VERBOSITY) std::cerr<<"INFO: "
+#define GYOTO_INFO							\
+  if (!GYOTO_UNLIKELY(Gyoto::verbosity_ >= GYOTO_INFO_VERBOSITY)) {}	\
+  else std::cerr << "INFO: "
 
   /// Unit ignored because libudunits2 was disabled.
   /**
@@ -295,7 +343,9 @@ namespace Gyoto {
    * GYOTO_DEBUG << "message" << endl;
    * \endcode
    */
-#define GYOTO_DEBUG  if (GYOTO_DEBUG_MODE) std::cerr << "DEBUG: " << __PRETTY_FUNCTION__ << ": "
+#define GYOTO_DEBUG						\
+  if (!GYOTO_DEBUG_MODE) {}					\
+  else std::cerr << "DEBUG: " << __PRETTY_FUNCTION__ << ": "
 
   /// Start debug-only block.
   /**
@@ -312,7 +362,17 @@ namespace Gyoto {
 #define GYOTO_ENDIF_DEBUG }
 
   /// Whether debug mode is activated (run-time).
-#define GYOTO_DEBUG_MODE Gyoto::debug()
+  /**
+   * A single test of Gyoto::debug_mode_, marked unlikely. When Gyoto
+   * is configured with --disable-debugging, this is the constant 0
+   * and the debug macros above compile to nothing: their arguments
+   * are still type-checked but never evaluated.
+   */
+#if GYOTO_DEBUG_ENABLED
+# define GYOTO_DEBUG_MODE GYOTO_UNLIKELY(Gyoto::debug_mode_)
+#else
+# define GYOTO_DEBUG_MODE 0
+#endif
 
   //\}
   //\{
@@ -356,6 +416,22 @@ namespace Gyoto {
  */
 #define GYOTO_DEFAULT_MAXITER 100000
 
+/**
+ * \brief Default value for Gyoto::Photon::transmission_cutoff_
+ *
+ * Also the transmission below which Photon::hit() stops integrating
+ * an optically thick Photon.
+ */
+#define GYOTO_DEFAULT_TRANSMISSION_CUTOFF 1e-6
+
+/**
+ * \brief Default value for Gyoto::Scenery::roimargin_
+ *
+ * In geometrical units. Covers the frame-dragging correction to the
+ * Schwarzschild bound on the impact parameter in a Kerr metric.
+ */
+#define GYOTO_DEFAULT_ROI_MARGIN 2.
+
 /**
  * \brief Precision on the determination of a date
  *
@@ -367,6 +443,65 @@ namespace Gyoto {
 /// \brief Default value for Screen::dmax_
 #define GYOTO_SCREEN_DMAX 1e7
 
+/// Maximum number of disk crossings stored in a transfer function
+/**
+ * See GYOTO_QUANTITY_TRANSFERFUNCTION.
+ */
+#define GYOTO_TRANSFER_MAXCROSS 4
+
+/// Number of doubles stored for each disk crossing
+/**
+ * 8 coordinates of the object, 8 coordinates of the photon, and dt.
+ */
+#define GYOTO_TRANSFER_CROSSSIZE 17
+
+/// Number of doubles stored per pixel in a transfer function
+#define GYOTO_TRANSFER_SIZE (GYOTO_TRANSFER_MAXCROSS*GYOTO_TRANSFER_CROSSSIZE)
+
+/// Number of steps in each chunk of a Star orbit table
+/**
+ * See Gyoto::Astrobj::Star::OrbitTable.
+ */
+#define GYOTO_STAR_CHUNK 64
+
+/// Largest step of Standard::Impact(), in units of Standard::giveDelta()
+#define GYOTO_STANDARD_MAXSTEP 8
+
+/// Relative tolerance of the adaptive quadrature in Standard::Impact()
+#define GYOTO_STANDARD_QUADTOL 1e-3
+
+/// Number of Photon lanes integrated together in packet mode
+/**
+ * See Scenery::packetTracing() and Photon::hit(size_t n, Photon *
+ * const ph[], Astrobj::Properties * const data[], int hitt[]). 4
+ * lanes of double precision fill an AVX2 register, 8 an AVX-512
+ * one. May be overridden at compile time.
+ */
+#ifndef GYOTO_PACKET_SIZE
+#define GYOTO_PACKET_SIZE 4
+#endif
+
+/// Scene is invariant under reflection through the equatorial plane
+/**
+ * Bit returned by Metric::Generic::getSymmetries() and
+ * Astrobj::Generic::getSymmetries(). The reflection is theta ->
+ * pi-theta in spherical coordinates, z -> -z in Cartesian
+ * coordinates.
+ */
+#define GYOTO_SYMMETRY_EQUATORIAL 1
+
+/// Pixels (i, j) and (npix+1-i, j) are mirror images
+/**
+ * Returned by Screen::getMirror().
+ */
+#define GYOTO_SCREEN_MIRROR_I 1
+
+/// Pixels (i, j) and (i, npix+1-j) are mirror images
+/**
+ * Returned by Screen::getMirror().
+ */
+#define GYOTO_SCREEN_MIRROR_J 2
+
 //For displays with setw and setprecision
 /// Precision when outputting double values
 #define GYOTO_PREC  15
@@ -60,10 +60,27 @@ class Gyoto::Astrobj::Disk3D : public Gyoto::Astrobj::Generic {
    * An array of dimensionality double[nr_][nz_][nphi_][nnu_]. In FITS
    * format, the first dimension is nu, the second phi, the third
    * z and last r. It typically contains temperature and is used only by
-   * subclasses.
+   * subclasses, through emissquant().
+   *
+   * If Disk3D::brick_ is not 0, the cells are stored by bricks
+   * instead (see brickSize()). NULL if Disk3D::single_precision_ is
+   * true, emissquantf_ being used instead.
    */
   double * emissquant_; ///< Physical quantity yielding emission.
 
+  /// Same as emissquant_, in single precision
+  float * emissquantf_;
+
+  /**
+   * XML element: &lt;SinglePrecision/&gt;.
+   */
+  bool single_precision_; ///< Whether to store emissquant_ as float
+
+  /**
+   * XML element: &lt;BrickSize&gt;.
+   */
+  size_t brick_; ///< Size of the bricks of emissquant_, 0 if row-major
+
   /**
    * An array of dimensionality double[nr_][nz_][nphi_][3]. In FITS format,
    * the second dimension is phi, the third z and last r. The first plane in
@@ -97,6 +114,27 @@ class Gyoto::Astrobj::Disk3D : public Gyoto::Astrobj::Generic {
   size_t nr_; ///< Number of rows in the patternGrid size in the r direction
   double rout_; ///< Outer radius of the grid
 
+  /**
+   * Maximum of emissquant_ over &nu; and over blocks of
+   * 2<SUP>l</SUP>&times;2<SUP>l</SUP>&times;2<SUP>l</SUP> (&phi;, z,
+   * r) cells, for l=0 to nlevels_-1. The levels are stored one after
+   * the other, each in the same order as emissquant_. Built by
+   * fitsRead() and copyEmissquant().
+   */
+  double * occupancy_; ///< Max-value pyramid over emissquant_
+  size_t nlevels_; ///< Number of levels in occupancy_
+
+  /**
+   * During radiative transfer, grid cells in which emissquant_ never
+   * exceeds this value are considered empty: Impact() steps over
+   * whole empty blocks of occupancy_ instead of computing the
+   * emission in each cell. -DBL_MAX (default) disables skipping.
+   *
+   * XML element: &lt;SkipThreshold&gt;.
+   */
+  double skip_threshold_; ///< Empty-space threshold on emissquant_
+
+  size_t nskipped_; ///< Number of empty cells or blocks skipped by Impact()
 
 
   // Constructors - Destructor
@@ -125,10 +163,18 @@ class Gyoto::Astrobj::Disk3D : public Gyoto::Astrobj::Generic {
    *
    * This is a low-level function. Beware that:
    *  - previously allocated array will not be freed automatically;
-   *  - array attached when the destructor is called will be freed.
+   *  - array attached when the destructor is called will be freed;
+   *  - Disk3D::occupancy_ is not updated (see buildOccupancy()).
    */
   void setEmissquant(double * pattern);
 
+  /// Set Disk3D::emissquantf_.
+  /**
+   * Same as setEmissquant(double * pattern) for single precision
+   * storage. Disk3D::emissquant_ is set to NULL.
+   */
+  void setEmissquant(float * pattern);
+
   /// Set Disk3D::velocity__.
   /**
    * The pointer is copied directly, not the array content.
@@ -159,8 +205,25 @@ class Gyoto::Astrobj::Disk3D : public Gyoto::Astrobj::Generic {
 			      size_t const naxes[4] = NULL);
 
   /// Get Disk3D::emissquant_.
+  /**
+   * The array is stored as described by brickSize() and is NULL if
+   * singlePrecision() is true.
+   */
   virtual double const * getEmissquant() const;
 
+  /// Get Disk3D::emissquantf_.
+  virtual float const * getEmissquantFloat() const;
+
+  /// Copy Disk3D::emissquant_ in row-major layout and double precision.
+  /**
+   * \param[out] dest Array of dimensionality
+   * double[nr_][nz_][nphi_][nnu_], whatever the storage.
+   */
+  virtual void getEmissquant(double * dest) const;
+
+  /// Number of elements actually stored in Disk3D::emissquant_.
+  size_t getEmissquantSize() const;
+
   /// Get { Disk3D::nnu_, Disk3D::nphi_, Disk3D::nz_, Disk3D::nr_ }.
   virtual void getEmissquantNaxes( size_t naxes[4] ) const ;
 
@@ -227,6 +290,32 @@ class Gyoto::Astrobj::Disk3D : public Gyoto::Astrobj::Generic {
   /// Get Disk3D::phimax_.
   double phimax() const;
 
+  /// Set Disk3D::single_precision_.
+  /**
+   * Data already loaded are converted. Set it before reading the
+   * FITS file to never hold the double precision array in memory.
+   */
+  void singlePrecision(bool mode);
+  /// Get Disk3D::single_precision_.
+  bool singlePrecision() const;
+
+  /// Set Disk3D::brick_.
+  /**
+   * If not 0, emissquant_ is stored by bricks of n&times;n&times;n
+   * (&phi;, z, r) cells, themselves in row-major order, so that
+   * spatially neighbouring cells are close in memory. The grid is
+   * padded to a whole number of bricks. Data already loaded are
+   * reordered.
+   */
+  void brickSize(size_t n);
+  /// Get Disk3D::brick_.
+  size_t brickSize() const;
+
+  /// Set Disk3D::skip_threshold_.
+  void skipThreshold(double thr);
+  /// Get Disk3D::skip_threshold_.
+  double skipThreshold() const;
+
   virtual int setParameter(std::string name,
 			   std::string content,
 			   std::string unit);
@@ -235,6 +324,77 @@ class Gyoto::Astrobj::Disk3D : public Gyoto::Astrobj::Generic {
   void getIndices(size_t i[4], double const co[4], double nu=0.) const ;
   ///< Get emissquant_ cell corresponding to position co[4].
 
+  /// Value of emissquant_ in cell i, whatever the storage
+  /**
+   * \param i {i_nu, i_phi, i_z, i_r}, as returned by getIndices().
+   */
+  double emissquant(size_t const i[4]) const;
+
+  /// Get grid cell containing a point given in cylindrical coordinates
+  /**
+   * \param[out] c {i_phi, i_z, i_r}, as in getIndices(), or {-1,
+   * -1, -1} outside the grid.
+   * \param[in] cyl {&phi;, z, r} (cylindrical coordinates).
+   * \return 1 if cyl is inside the grid, 0 otherwise.
+   */
+  int gridCell(long c[3], double const cyl[3]) const;
+
+  /// Time before a straight path leaves the current cell
+  /**
+   * Starting from cyl, moving at rate (derivative of cyl with
+   * respect to the integration parameter), time needed to reach the
+   * nearest face of the gridCell() containing cyl or, outside the
+   * grid, the nearest face of the grid. DBL_MAX if none is reached.
+   *
+   * If level is not 0, the faces are those of the block of
+   * 2<SUP>level</SUP> cells per side of occupancy_ containing cyl.
+   */
+  double cellExit(double const cyl[3], double const rate[3],
+		  size_t level=0) const;
+
+  /// Compute Disk3D::occupancy_
+  /**
+   * The first level of the pyramid is the maximum of emissquant_
+   * over &nu;. Each following level is the maximum over blocks of
+   * 2&times;2&times;2 cells of the previous one. If emissquant_ is
+   * not set, occupancy_ is freed and Impact() never skips.
+   *
+   * \param merge If true, the first level is the maximum of the
+   * current one and of emissquant_. Subclasses which swap
+   * emissquant_ with setEmissquant() should merge all the arrays
+   * they swap in.
+   */
+  void buildOccupancy(bool merge=false);
+
+  /// Number of the largest empty level containing a cell
+  /**
+   * \param c {i_phi, i_z, i_r} as returned by gridCell().
+   * \return The largest l such that the block of occupancy_ at level
+   * l containing c does not exceed Disk3D::skip_threshold_, or -1 if
+   * c itself does.
+   */
+  int emptyLevel(long const c[3]) const;
+
+ private:
+  /// Allocate emissquant_ or emissquantf_ for the current layout
+  void allocateEmissquant();
+
+  /// Store one radius of a row-major array in the current layout
+  /**
+   * \param slab Array of dimensionality double[nz_][nphi_][nnu_].
+   * \param ir Radius index of slab.
+   */
+  void storeEmissquant(double const * slab, size_t ir);
+
+ protected:
+  /// Convert emissquant_ to a new storage
+  /**
+   * Called by singlePrecision() and brickSize(). Subclasses which
+   * swap emissquant_ with setEmissquant() must convert all the arrays
+   * they swap in.
+   */
+  virtual void repackEmissquant(bool single, size_t brick);
+
  public:
   int Impact(Photon *ph, size_t index, Astrobj::Properties *data);
 
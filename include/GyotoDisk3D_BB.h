@@ -73,6 +73,9 @@ class Gyoto::Astrobj::Disk3D_BB : public Astrobj::Disk3D {
    */
   double ** temperature_array_;
 
+  /// Same as temperature_array_ if Disk3D::singlePrecision() is true
+  float ** temperaturef_array_;
+
   /**
    * An array of arrays of dimensionality double[nr_][nz_][nphi_][3].
    * In FITS format, the second dimension is phi, and the third r. 
@@ -128,6 +131,9 @@ class Gyoto::Astrobj::Disk3D_BB : public Astrobj::Disk3D {
    */
   void copyQuantities(int iq) ;
 
+  /// Convert the temperature of all the date slices to a new storage
+  virtual void repackEmissquant(bool single, size_t brick);
+
  public:
 #ifdef GYOTO_USE_XERCES
   virtual void fillElement(FactoryMessenger *fmp) const ;
@@ -31,6 +31,9 @@
 #include <fstream>
 #include <iomanip>
 #include <cstring>
+#include <string>
+#include <vector>
+#include <list>
 
 namespace Gyoto{
   namespace Astrobj { class DynamicalDisk; }
@@ -46,49 +49,60 @@ namespace Gyoto{
  *   This class describes a PatternDiskBB that evolves dynamically. 
  *   It is described by a set of FITS files.
  *
+ *   Only the first FITS file is read when the directory is set
+ *   (XML element &lt;File&gt;). The other snapshots are read on
+ *   first use and kept in a SnapshotCache, shared by all the clones
+ *   of the object (one per thread in Scenery::rayTrace()). The
+ *   memory used by the cache can be bounded with
+ *   &lt;CacheSize&gt;, in megabytes: the least recently used
+ *   snapshots are then dropped. When compiled with libpthread, the
+ *   snapshot preceding the one being used is read in the background
+ *   (photons are integrated backwards in time), unless
+ *   &lt;NoPrefetch/&gt; is set.
+ *
+ *   Alternatively, &lt;PreloadThreads&gt;n&lt;/PreloadThreads&gt;
+ *   reads all the snapshots (as many as fit in &lt;CacheSize&gt;)
+ *   when the directory is set, using n concurrent threads. It must
+ *   come before &lt;File&gt;. Unless cfitsio was built thread-safe
+ *   (--enable-reentrant), the FITS files are nevertheless read one
+ *   at a time, as are the snapshots read by the prefetching thread
+ *   and by the clones.
+ *
+ *   All the snapshots must share the same grid dimensions.
  */
 class Gyoto::Astrobj::DynamicalDisk : public Astrobj::PatternDiskBB {
   friend class Gyoto::SmartPointer<Gyoto::Astrobj::DynamicalDisk>;
+ public:
+  class Snapshot;
+  class SnapshotCache;
+
  private:
-  char* dirname_; ///< FITS files directory
+  std::string dirname_; ///< FITS files directory
   double tinit_; ///< date of the first FITS file
   double dt_; ///< Time increment between two FITS (assumed constant)
   int nb_times_; ///< Number of dates
+  double cache_size_; ///< Memory budget of the snapshot cache in bytes, 0 for no limit
+  bool prefetch_; ///< Whether to read the next snapshot in the background
+  size_t preload_threads_; ///< Threads reading all snapshots at once, 0 for none
 
-  /// Array of PatternDisk::emission_ arrays
-  double ** emission_array_;
-
-  /// Array of PatternDisk::opacity_ arrays
-  double ** opacity_array_;
-
-  /// Array of PatternDisk::velocity_ arrays
-  double ** velocity_array_; ///< 
-
-  /// Array of PatternDisk::radius_ arrays
-  double ** radius_array_; ///< radius vector
-
-  /// Array of PatternDisk::dnu_ values
-  double * dnu_array_;
-
-  /// Array of PatternDisk::nu0_ values
-  double * nu0_array_;
+  /// Snapshots read so far, shared by all the clones
+  Gyoto::SmartPointer<SnapshotCache> cache_;
 
-  /// Array of PatternDisk::nu1_ values
-  size_t * nnu_array_;
-
-
-  /// Array of PatternDisk::dphi_ values
-  double * dphi_array_;
-
-  /// Array of PatternDisk::nphi_ values
-  size_t * nphi_array_;
-
-
-  /// Array of PatternDisk::dr_ values
-  double * dr_array_;
+  /// Last two snapshots used by this instance
+  /**
+   * emission() and getVelocity() interpolate between two
+   * consecutive snapshots: copyQuantities() looks them up here
+   * before asking DynamicalDisk::cache_, which needs a lock.
+   */
+  Gyoto::SmartPointer<Snapshot> recent_[2];
+  int recent_iq_[2]; ///< Indices of DynamicalDisk::recent_, 0 for none
+  int recent_last_; ///< Slot of DynamicalDisk::recent_ used last
 
-  /// Array of PatternDisk::nr_ values
-  size_t * nr_array_;
+  /// Snapshot the PatternDisk arrays currently point to, or NULL
+  /**
+   * Always one of DynamicalDisk::recent_, which owns it.
+   */
+  Snapshot const * current_;
 
   // Constructors - Destructor
   // -------------------------
@@ -108,6 +122,31 @@ class Gyoto::Astrobj::DynamicalDisk : public Astrobj::PatternDiskBB {
 			   std::string content,
 			   std::string unit);
 
+  /// Set DynamicalDisk::cache_size_, in bytes (0 for no limit)
+  /**
+   * At least two snapshots are kept whatever the budget, since
+   * emission() interpolates between two of them. In addition, each
+   * clone holds on to the last two snapshots it used.
+   */
+  void cacheSize(double bytes);
+  double cacheSize() const; ///< Get DynamicalDisk::cache_size_ in bytes
+
+  void prefetch(bool mode); ///< Set DynamicalDisk::prefetch_
+  bool prefetch() const; ///< Get DynamicalDisk::prefetch_
+
+  /// Set DynamicalDisk::preload_threads_, used when the directory is set
+  void preloadThreads(size_t n);
+  size_t preloadThreads() const; ///< Get DynamicalDisk::preload_threads_
+
+  /// Set PatternDisk::single_precision_
+  /**
+   * The snapshots already read belong to DynamicalDisk::cache_ and
+   * cannot be converted in place: if the directory is already set,
+   * the cache is rebuilt and the snapshots are read again.
+   */
+  virtual void singlePrecision(bool mode);
+  using PatternDiskBB::singlePrecision;
+
   using PatternDiskBB::emission;
   virtual double emission(double nu_em, double dsem,
 			  double c_ph[8], double c_obj[8]) const;
@@ -119,10 +158,30 @@ class Gyoto::Astrobj::DynamicalDisk : public Astrobj::PatternDiskBB {
 
   /// Set underlying PatternDisk pointers to a specific date slice.
   /**
+   * The snapshot is read if it is not in the cache yet.
+   *
    * \param iq Index of the date slice.
    */
   void copyQuantities(int iq) ;
 
+ private:
+  /// Point the PatternDisk arrays to snap, or to NULL
+  /**
+   * The arrays previously attached are not freed: they belong to
+   * DynamicalDisk::current_, which is replaced by snap.
+   */
+  void attachQuantities(Snapshot const * snap);
+
+  /// Forget DynamicalDisk::recent_, detaching the arrays first
+  void forgetSnapshots();
+
+  /// Start a new cache holding snapshot 1, read through reader
+  /**
+   * When reader is this instance, the first snapshot also sets the
+   * grid and the other PatternDisk parameters.
+   */
+  void newCache(PatternDisk * reader);
+
  public:
 #ifdef GYOTO_USE_XERCES
   virtual void fillElement(FactoryMessenger *fmp) const ;
@@ -130,4 +189,114 @@ class Gyoto::Astrobj::DynamicalDisk : public Astrobj::PatternDiskBB {
 
 };
 
+/**
+ * \class Gyoto::Astrobj::DynamicalDisk::Snapshot
+ * \brief The arrays read from one FITS file of a DynamicalDisk
+ *
+ * The arrays are freed when the last SmartPointer to the Snapshot
+ * is released, so that a snapshot dropped from the SnapshotCache
+ * remains valid for the DynamicalDisk clones still using it.
+ */
+class Gyoto::Astrobj::DynamicalDisk::Snapshot
+  : protected Gyoto::SmartPointee
+{
+  friend class Gyoto::SmartPointer<Snapshot>;
+ public:
+  double * emission; ///< PatternDisk::emission_, or NULL
+  float * emissionf; ///< PatternDisk::emissionf_, or NULL
+  double * opacity; ///< PatternDisk::opacity_, or NULL
+  float * opacityf; ///< PatternDisk::opacityf_, or NULL
+  double * velocity; ///< PatternDisk::velocity_
+  double * radius; ///< PatternDisk::radius_
+  double dnu; ///< PatternDisk::dnu_
+  double nu0; ///< PatternDisk::nu0_
+  size_t naxes[3]; ///< {nnu, nphi, nr}
+
+  /// Take ownership of the arrays of pd, which is left without data
+  Snapshot(PatternDisk * pd);
+  ~Snapshot(); ///< Free the arrays
+  size_t bytes() const; ///< Memory used by the arrays
+};
+
+/**
+ * \class Gyoto::Astrobj::DynamicalDisk::SnapshotCache
+ * \brief Snapshots of a DynamicalDisk, read on demand
+ *
+ * Thread-safe: all the clones of a DynamicalDisk share the same
+ * cache. A snapshot requested by several threads at once is read
+ * only once.
+ */
+class Gyoto::Astrobj::DynamicalDisk::SnapshotCache
+  : protected Gyoto::SmartPointee
+{
+  friend class Gyoto::SmartPointer<SnapshotCache>;
+ private:
+  std::string dirname_; ///< FITS files directory
+  int nb_times_; ///< Number of snapshots
+  bool single_precision_; ///< Read snapshots in single precision
+  size_t naxes_[3]; ///< Grid dimensions, which all snapshots must share
+  double budget_; ///< Memory budget in bytes, 0 for no limit
+  size_t bytes_; ///< Memory used by the cached snapshots
+
+  /// Cached snapshots, NULL for those not in memory; index iq-1
+  std::vector<Gyoto::SmartPointer<Snapshot> > snapshots_;
+  std::vector<bool> loading_; ///< Snapshots being read; index iq-1
+  std::list<int> lru_; ///< Cached snapshots, most recently used first
+
+# ifdef HAVE_PTHREAD
+  pthread_mutex_t mutex_; ///< Protects all of the above
+  pthread_cond_t loaded_; ///< Signaled each time a snapshot has been read
+  pthread_t thread_; ///< Prefetching thread
+  bool thread_busy_; ///< Whether thread_ is still reading
+  bool thread_joinable_; ///< Whether thread_ must be joined
+  int thread_iq_; ///< Snapshot read by thread_
+# endif
+  int preload_next_; ///< Next snapshot to read in preload()
+  std::string preload_error_; ///< First error met in preload()
+
+ public:
+  /// Set up an empty cache, the first snapshot sets the grid
+  SnapshotCache(std::string dirname, int nb_times, bool single_precision);
+  ~SnapshotCache(); ///< Wait for the prefetching thread
+
+  void budget(double bytes); ///< Set SnapshotCache::budget_
+
+  std::string filename(int iq) const; ///< Name of the FITS file of snapshot iq
+
+  /// Put snapshot iq in the cache
+  void insert(int iq, Gyoto::SmartPointer<Snapshot> snap);
+
+  /// Get snapshot iq, reading it if needed
+  Gyoto::SmartPointer<Snapshot> get(int iq);
+
+  /// Start reading snapshot iq in the background if not cached
+  /**
+   * Does nothing without libpthread, or if iq is out of range, or if
+   * a snapshot is already being read in the background.
+   */
+  void prefetch(int iq);
+
+  /// Read all the snapshots, or as many as fit in the budget
+  /**
+   * \param nthreads Number of snapshots read at once. Without
+   * libpthread, they are read one after the other.
+   */
+  void preload(size_t nthreads);
+
+ private:
+  /// Read snapshot iq, without locking the cache
+  /**
+   * Calls to cfitsio are serialised unless fits_is_reentrant().
+   */
+  Gyoto::SmartPointer<Snapshot> read(int iq) const;
+
+  /// Store snapshot iq and drop old snapshots if needed; lock held
+  void store(int iq, Gyoto::SmartPointer<Snapshot> snap);
+
+# ifdef HAVE_PTHREAD
+  static void * prefetchThread(void * arg); ///< Body of thread_
+# endif
+  static void * preloadThread(void * arg); ///< Body of the preload() threads
+};
+
 #endif
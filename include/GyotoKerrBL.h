@@ -76,6 +76,8 @@ class Gyoto::Metric::KerrBL : public Metric::Generic {
  public:
   double getSpin() const ; ///< Returns spin
 
+  virtual int getSymmetries() const;
+
   double getRms() const; ///< Returns prograde marginally stable orbit
 
   double getRmb() const; ///< Returns prograde marginally bound orbit
@@ -107,6 +109,18 @@ class Gyoto::Metric::KerrBL : public Metric::Generic {
   virtual void circularVelocity(double const pos[4], double vel [4],
 				double dir=1.) const ;
 
+  /// Closed-form Metric::Generic::propagateFarField()
+  /**
+   * With the constants of motion of the photon, the radial motion
+   * reduces to quadratures in u=1/r (Gauss-Legendre) and the polar
+   * motion in Mino time to a smooth one-dimensional ODE, which also
+   * gives the time and azimuth offsets. coord is left untouched if
+   * the photon is not going outwards, comes from a radial turning
+   * point close to or beyond rstart, or has a negative Carter
+   * constant.
+   */
+  virtual int propagateFarField(double coord[8], double rstart) const;
+
  public:
   void MakeCoord(const double coordin[8], const double cst[5], double coordout[8]) const ;
   ///< Inverse function of MakeMomentumAndCst
@@ -116,11 +130,34 @@ class Gyoto::Metric::KerrBL : public Metric::Generic {
   ///< Transforms from Boyer-Lindquist coordinates [t,r,th,phi,tdot,rdot,thdot,phidot] to [t,r,th,phi,pt,pr,pth,pphi] where pt,pr... are generalized momenta.
  
 
-  virtual void setParameter(std::string, std::string, std::string);
+  virtual int setParameter(std::string, std::string, std::string);
 #ifdef GYOTO_USE_XERCES
   virtual void fillElement(FactoryMessenger *fmp); ///< called from Factory
 #endif
 
+ public:
+  /// Adaptive RK4 for a packet of up to GYOTO_PACKET_SIZE Worldlines
+  /**
+   * Same as myrk4_adaptive(Gyoto::Worldline* line, ...) for n lanes
+   * at once: the lanes are advanced in lockstep, each with its own
+   * step control, and drop out of the packet when their step is
+   * accepted. Lanes for which active is 0 are not integrated.
+   *
+   * \param n Number of lanes, at most GYOTO_PACKET_SIZE;
+   * \param line Worldline of each lane (for the constants of motion);
+   * \param coordin Starting point of each lane;
+   * \param[out] coordout1 End point of each lane;
+   * \param h0in Step to try for each lane;
+   * \param[out] h1 Next step for each lane;
+   * \param active Whether to integrate each lane;
+   * \param[out] ret What myrk4_adaptive() returns, for each active lane.
+   */
+  void myrk4_adaptive(size_t n, Worldline * const line[],
+		      double const * const coordin[],
+		      double * const coordout1[],
+		      const double h0in[], double h1[],
+		      int const active[], int ret[]) const;
+
  protected:
 
   // outside the API
@@ -130,6 +167,30 @@ class Gyoto::Metric::KerrBL : public Metric::Generic {
  private:
   int myrk4(const double coor[8], const double cst[5], double h, double res[8]) const;///< Internal-use RK4 proxy
   int myrk4_adaptive(Gyoto::Worldline* line, const double coor[8], double lastnorm, double normref, double coor1[8], double h0, double& h1) const; ///< Interal-use adaptive RK4 proxy
+
+  /// Internal-use RK4 proxy for a packet of GYOTO_PACKET_SIZE lanes
+  /**
+   * Arrays are stored as structures of arrays (coor[i][lane]) so that
+   * the lanes can be computed with SIMD instructions. Only lanes for
+   * which mask is set are checked for errors, ret[lane] is what
+   * myrk4(const double coor[8], ...) would return. On x86 CPUs that
+   * support AVX2, a version compiled for it is used.
+   */
+  void myrk4(const double coor[8][GYOTO_PACKET_SIZE],
+	     const double cst[5][GYOTO_PACKET_SIZE],
+	     const double h[GYOTO_PACKET_SIZE],
+	     double res[8][GYOTO_PACKET_SIZE],
+	     int const mask[GYOTO_PACKET_SIZE],
+	     int ret[GYOTO_PACKET_SIZE]) const;
+
+  /// Accept a step in myrk4_adaptive()
+  /**
+   * Compute next step h1, enforce conservation of the constants of
+   * motion and switch coor1 back to Boyer-Lindquist coordinates.
+   */
+  void myrk4_adaptive_accept(double coor1[8], const double cst[5],
+			     double r0, double err, double h0,
+			     double coordout1[8], double &h1) const;
   /**
    * \brief Ensure conservation of the constants of motion
    *
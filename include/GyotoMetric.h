@@ -177,6 +177,12 @@ class Gyoto::Metric::Generic
   int getCoordKind() const; ///< Get coordinate kind
   void setCoordKind(int coordkind); ///< Set coordinate kind
 
+  /**
+   * Bitwise OR of GYOTO_SYMMETRY_* flags describing discrete
+   * symmetries of the metric. The default (0) is always safe.
+   */
+  virtual int getSymmetries() const; ///< Symmetries of the metric
+
   double getMass() const;        ///< Get mass used in unitLength()
   double getMass(const std::string &unit) const; ///< Get mass used in unitLength()
 
@@ -274,9 +280,9 @@ int MyKind::setParameter(std::string name, std::string content, std::string unit
    * \param unit string representation of the unit
    * \return 0 if this parameter is known, 1 if it is not.
    */
-  virtual void setParameter(std::string name,
-			    std::string content,
-			    std::string unit);
+  virtual int setParameter(std::string name,
+			   std::string content,
+			   std::string unit);
 
   // Outputs
 #ifdef GYOTO_USE_XERCES
@@ -364,6 +370,24 @@ Gyoto::Metric::MyKind::Subcontractor(FactoryMessenger* fmp) {
    */
   virtual int isStopCondition(double const * const coord) const;
 
+  /**
+   * \brief Move a photon back along its geodesic to radius rstart
+   *
+   * Used by Scenery to skip the far field, where the geodesic of a
+   * photon coming from a distant Screen is nearly straight: coord is
+   * replaced by the point where this null geodesic crossed the sphere
+   * of radius rstart before reaching its current position. Metrics
+   * which know their geodesics in closed form implement this
+   * (Metric::KerrBL).
+   *
+   * \param[in,out] coord 8-coordinate of a photon;
+   * \param rstart radius of the sphere.
+   * \return 1 if coord was moved, 0 if it was left untouched: the
+   * default implementation always does that, implementations do it
+   * for instance when the geodesic does not come from within rstart.
+   */
+  virtual int propagateFarField(double coord[8], double rstart) const;
+
   /**
    * \brief F function such as dy/dtau=F(y,cst)
    */
@@ -59,6 +59,11 @@ namespace Gyoto{
  *   default quantity returned if nothing is requested. The other
  *   quantities implemented in ThinDisk are also provided.
  *
+ *   The intensity depends only on r. It is tabulated on a grid
+ *   uniform in 1/r, from the ISCO to infinity, each time the spin
+ *   changes, and interpolated linearly. The XML element
+ *   &lt;ExactEmission/&gt; evaluates the Page & Thorne formula at
+ *   each hit instead.
  */
 class Gyoto::Astrobj::PageThorneDisk
 : public Astrobj::ThinDisk,
@@ -72,6 +77,9 @@ class Gyoto::Astrobj::PageThorneDisk
   double x1_; ///< Value cached for bolometricEmission()
   double x2_; ///< Value cached for bolometricEmission()
   double x3_; ///< Value cached for bolometricEmission()
+  double * flux_table_; ///< Intensity tabulated by tabulate()
+  double table_scale_; ///< Position of r in flux_table_ is table_scale_/r
+  bool exact_; ///< Whether bolometricEmission() bypasses flux_table_
 
   // Constructors - Destructor
   // -------------------------
@@ -93,6 +101,16 @@ class Gyoto::Astrobj::PageThorneDisk
   virtual void updateSpin() ;
   ///< Get spin from metric, which must be KerrBL or KerrKS
 
+  void exactEmission(bool mode); ///< Set PageThorneDisk::exact_
+  bool exactEmission() const; ///< Get PageThorneDisk::exact_
+
+ private:
+  /// Page & Thorne intensity at r=xx<SUP>2</SUP>, for dsem=1
+  double intensity(double xx) const;
+
+  /// Fill PageThorneDisk::flux_table_, called by updateSpin()
+  void tabulate();
+
  public:
   using ThinDisk::emission;
   /**
@@ -122,6 +140,10 @@ class Gyoto::Astrobj::PageThorneDisk
 
   Quantity_t getDefaultQuantities();
 
+  virtual int setParameter(std::string name,
+			   std::string content,
+			   std::string unit);
+
   // Hook::Listener API //
  public:
   /**
@@ -61,6 +61,17 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
 
   double * opacity_; ///< Same dimenstions as emission, or NULL
 
+  float * emissionf_; ///< Same as emission_, in single precision
+  float * opacityf_; ///< Same as opacity_, in single precision
+
+  /**
+   * If true, emission_ and opacity_ are NULL and their content is
+   * stored in emissionf_ and opacityf_ instead.
+   *
+   * XML element: &lt;SinglePrecision/&gt;.
+   */
+  bool single_precision_; ///< Whether to store emission_ and opacity_ as float
+
   /**
    * An array of dimensionality double[nr_][nphi_][2]. In FITS format,
    * the second dimension is phi, and the third r. The first plane in
@@ -103,6 +114,45 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
   double dr_; ///< Radius step
   size_t nr_; ///< Number of rows in the patternGrid size in the r direction
 
+  /**
+   * If false (default), the value of the nearest grid cell is
+   * used, except along r when radius_ is set: then the grid cell
+   * just inside r is used. If true, emission_, opacity_ and velocity_ are
+   * interpolated linearly along each of the (&nu;, &phi;, r) axes.
+   *
+   * XML element: &lt;Interpolate/&gt;.
+   */
+  bool interpolate_; ///< Whether to interpolate between grid cells
+
+  /**
+   * An array of dimensionality double[nr_][nphi_][2]: maximum over
+   * &nu; of emission_ (occupancy_[r][phi][0]) and of opacity_
+   * (occupancy_[r][phi][1], -DBL_MAX if opacity_ is not set) in each
+   * grid cell. Built by fitsRead(), copyIntensity() and
+   * copyOpacity().
+   */
+  double * occupancy_; ///< Per-cell maxima of emission_ and opacity_
+
+  /**
+   * During radiative transfer, crossings of the disk in grid cells
+   * where emission_ does not exceed this value and opacity_ does not
+   * exceed PatternDisk::opacity_skip_threshold_ are ignored instead
+   * of being integrated. -DBL_MAX (default) disables skipping.
+   *
+   * XML element: &lt;SkipThreshold&gt;.
+   */
+  double skip_threshold_; ///< Empty-space threshold on emission_
+
+  /**
+   * Opacity counterpart of PatternDisk::skip_threshold_. The default
+   * (0.) only lets transparent cells be skipped.
+   *
+   * XML element: &lt;OpacitySkipThreshold&gt;.
+   */
+  double opacity_skip_threshold_; ///< Empty-space threshold on opacity_
+
+  mutable size_t nskipped_; ///< Number of crossings skipped
+
 
   // Constructors - Destructor
   // -------------------------
@@ -141,10 +191,36 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
    *
    * This is a low-level function. Beware that:
    *  - previously allocated array will not be freed automatically;
-   *  - array attached when the destructor is called will be freed.
+   *  - array attached when the destructor is called will be freed;
+   *  - PatternDisk::occupancy_ is not updated (see buildOccupancy()).
    */
   void setEmission(double * pattern);
 
+  /// Set PatternDisk::emissionf_
+  /**
+   * Same as setEmission(double * pattern) for single precision
+   * storage. PatternDisk::emission_ is set to NULL.
+   */
+  void setEmission(float * pattern);
+
+  /// Set PatternDisk::opacity_
+  /**
+   * The pointer is copied directly, not the array content.
+   * PatternDisk::opacityf_ is set to NULL.
+   *
+   * This is a low-level function. Beware that:
+   *  - previously allocated array will not be freed automatically;
+   *  - array attached when the destructor is called will be freed.
+   */
+  void setOpacity(double * pattern);
+
+  /// Set PatternDisk::opacityf_
+  /**
+   * Same as setOpacity(double * pattern) for single precision
+   * storage. PatternDisk::opacity_ is set to NULL.
+   */
+  void setOpacity(float * pattern);
+
   /// Set PatternDisk::velocity__
   /**
    * The pointer is copied directly, not the array content.
@@ -185,7 +261,10 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
   virtual void copyIntensity(double const * const pattern = NULL,
 			      size_t const naxes[3] = NULL);
 
-  virtual double const * getIntensity() const;///< Get PatternDisk::emission_
+  virtual double const * getIntensity() const;///< Get PatternDisk::emission_ (NULL in single precision)
+  virtual float const * getIntensityFloat() const;///< Get PatternDisk::emissionf_
+  /// Copy PatternDisk::emission_ in double precision, whatever the storage
+  virtual void getIntensity(double * dest) const;
   virtual void getIntensityNaxes( size_t naxes[3] ) const ; ///< Get PatternDisk::nnu_, PatternDisk::nphi_, and PatternDisk::nr_
 
   /**
@@ -204,7 +283,10 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
    */
   virtual void copyOpacity(double const * const pattern = NULL,
 			      size_t const naxes[3] = NULL);
-  virtual double const * getOpacity() const; ///< Get PatternDisk::opacity_
+  virtual double const * getOpacity() const; ///< Get PatternDisk::opacity_ (NULL in single precision)
+  virtual float const * getOpacityFloat() const; ///< Get PatternDisk::opacityf_
+  /// Copy PatternDisk::opacity_ in double precision, whatever the storage
+  virtual void getOpacity(double * dest) const;
 
   /// Set PatternDisk::velocity_
   /**
@@ -255,6 +337,23 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
   void phimax(double phimax); ///< Set PatternDisk::phimax_
   double phimax() const; ///< Get PatternDisk::phimax_
 
+  void interpolate(bool mode); ///< Set PatternDisk::interpolate_
+  bool interpolate() const; ///< Get PatternDisk::interpolate_
+
+  /// Set PatternDisk::single_precision_
+  /**
+   * Data already loaded are converted.
+   */
+  virtual void singlePrecision(bool mode);
+  bool singlePrecision() const; ///< Get PatternDisk::single_precision_
+
+  void skipThreshold(double thr); ///< Set PatternDisk::skip_threshold_
+  double skipThreshold() const; ///< Get PatternDisk::skip_threshold_
+  /// Set PatternDisk::opacity_skip_threshold_
+  void opacitySkipThreshold(double thr);
+  /// Get PatternDisk::opacity_skip_threshold_
+  double opacitySkipThreshold() const;
+
   virtual int setParameter(std::string name,
 			   std::string content,
 			   std::string unit);
@@ -263,6 +362,63 @@ class Gyoto::Astrobj::PatternDisk : public Astrobj::ThinDisk {
   void getIndices(size_t i[3], double const co[4], double nu=0.) const ;
   ///< Get emission_ cell corresponding to position co[4]
 
+  /// Get the grid cells surrounding position co[4]
+  /**
+   * For each axis k in (&nu;, &phi;, r), i[k][0] and i[k][1] are the
+   * indices of the two grid nodes bracketing the position and w[k]
+   * is the weight of i[k][1]. The radial node is found by bisection
+   * in radius_ if it is set.
+   *
+   * If PatternDisk::interpolate_ is false, a single node is
+   * returned in both i[k][0] and i[k][1] and w[k] is 0: the nearest
+   * one, or the lower one along r if radius_ is set.
+   */
+  void getCell(size_t i[3][2], double w[3],
+	       double const co[4], double nu=0.) const ;
+
+  /// Value of array at the position described by getCell()
+  /**
+   * \param array Array of dimensionality double[nr_][nphi_][nfast].
+   * \param i, w As returned by getCell().
+   * \param nfast Size of the fastest varying dimension of array.
+   */
+  double gridValue(double const * array, size_t const i[3][2],
+		   double const w[3], size_t nfast) const ;
+
+  /// Same as gridValue(double const *, ...) for single precision arrays
+  double gridValue(float const * array, size_t const i[3][2],
+		   double const w[3], size_t nfast) const ;
+
+  /// Value of emission_ at the position described by getCell()
+  double gridIntensity(size_t const i[3][2], double const w[3]) const ;
+
+  /// Value of opacity_ at the position described by getCell(), 0 if none
+  double gridOpacity(size_t const i[3][2], double const w[3]) const ;
+
+  /// Compute PatternDisk::occupancy_
+  /**
+   * Maxima over &nu; of emission_ and of opacity_. If emission_ is
+   * not set, occupancy_ is freed and no crossing is ever skipped.
+   *
+   * \param merge If true, keep the maximum of the current occupancy_
+   * and of the current arrays. Subclasses which swap emission_ with
+   * setEmission() should merge all the arrays they swap in, provided
+   * they share the same grid.
+   */
+  void buildOccupancy(bool merge=false);
+
+  /// Free PatternDisk::occupancy_: no crossing will be skipped
+  void clearOccupancy();
+
+  /// Skip crossings in empty cells, see PatternDisk::skip_threshold_
+  virtual void processCrossing(Gyoto::Photon* ph, double* coord_ph_hit,
+			       double* coord_obj_hit, double dt,
+			       Astrobj::Properties* data) const;
+
+ private:
+  /// Convert emission_ and opacity_ to the storage set by single_precision_
+  void convertStorage();
+
  public:
   using ThinDisk::emission;
   virtual double emission(double nu_em, double dsem,
@@ -86,6 +86,41 @@ class Gyoto::Photon : public Gyoto::Worldline, protected Gyoto::SmartPointee {
    */
   double * transmission_;
 
+  /// Channels still taking part in the radiative transfer
+  /**
+   * Sorted indices of the elements of Photon::transmission_ which
+   * are above Photon::transmission_cutoff_. Only the first
+   * Photon::nactive_ elements are meaningful. Maintained by
+   * transmit() and resetTransmission().
+   */
+  size_t * active_;
+
+  /// Number of meaningful elements in Photon::active_
+  size_t nactive_;
+
+  /// Transmission at or below which a channel is considered opaque
+  /**
+   * See transmissionCutoff(double).
+   */
+  double transmission_cutoff_;
+
+  /// Astrobj::Generic::getEventFunction() of Photon::object_
+  Functor::Double_constDoubleArray * event_func_;
+
+  /// Level of the surface defined by Photon::event_func_
+  double event_value_;
+
+  /// Index of the step in which Photon::event_func_ crossed its level
+  /**
+   * The crossing happened between indices event_ind_ and
+   * event_ind_+1, size_t(-1) if there was no crossing in the last
+   * integration step. See getEvent().
+   */
+  size_t event_ind_;
+
+  /// Values of event_func_ minus event_value_ at both ends of that step
+  double event_f_[2];
+
   // Constructors - Destructor
   // -------------------------
 
@@ -176,6 +211,60 @@ class Gyoto::Photon : public Gyoto::Worldline, protected Gyoto::SmartPointee {
    */
   int hit(Astrobj::Properties *data=NULL);
 
+  /// Integrate the geodesics of a packet of Photons
+  /**
+   * Same as calling ph[l]->hit(data[l]) for each lane l, except that
+   * the Photons which live in a Metric::KerrBL are integrated in
+   * lockstep, see Worldline::IntegState::nextStep(size_t n,
+   * IntegState * const state[], ...). The Metric of the first of
+   * them is used for all those which have the same spin. Other
+   * Photons are integrated one after the other.
+   *
+   * \param n Number of lanes, at most GYOTO_PACKET_SIZE;
+   * \param ph The Photons, already initialized;
+   * \param[in,out] data Astrobj::Properties of each Photon (elements
+   * may be NULL);
+   * \param[out] hitt What hit() returns, for each Photon.
+   */
+  static void hit(size_t n, Photon * const ph[],
+		  Astrobj::Properties * const data[], int hitt[]);
+
+ protected:
+  /// State of the integration loop of hit()
+  struct HitState {
+    size_t ind;     ///< Index of the last computed step
+    int dir;        ///< Direction of integration, 1 or -1
+    int coordkind;  ///< Metric::Generic::getCoordKind()
+    double rmax;    ///< Astrobj::Generic::getRmax()
+    double rr_prev; ///< Radius at previous step
+    size_t count;   ///< Number of steps so far
+    int hitt;       ///< Return value of hit()
+    int stopcond;   ///< Whether integration is over
+    double evprev;  ///< Photon::event_func_ minus level at previous step
+    int evvalid;    ///< Whether evprev has been computed
+  };
+
+  /// Beginning of hit()
+  /**
+   * Reset transmissions, call Astrobj::Generic::Impact() on the
+   * already computed part of the geodesic, then set up st and coord
+   * for the integration loop.
+   *
+   * \return 1 if hit() is over already, with its result in st.hitt.
+   */
+  int hitStart(Astrobj::Properties *data, HitState &st, double coord[8]);
+
+  /// One iteration of the integration loop of hit()
+  /**
+   * Store the step that the integrator just computed in coord,
+   * returning stepstatus, call Astrobj::Generic::Impact() and check
+   * the stop conditions. Sets st.stopcond when integration is over.
+   */
+  void hitStep(Astrobj::Properties *data,
+	       HitState &st, double coord[8], int stepstatus);
+
+ public:
+
   /**
    * \brief Find minimum of photon--object distance
    *
@@ -215,6 +304,49 @@ class Gyoto::Photon : public Gyoto::Worldline, protected Gyoto::SmartPointee {
 		 double value,
 		 double tinside, double &toutside) ;
 
+  /// Date of a crossing located during integration
+  /**
+   * While integrating, hit() watches the sign of the function
+   * returned by Astrobj::Generic::getEventFunction() at each
+   * step. If it changed sign between indices index and index+1 (the
+   * last step), getEvent() locates the crossing by regula falsi
+   * (Illinois variant), first on the cubic Hermite interpolant of the
+   * step, then on getCoord(), which usually takes two or three
+   * evaluations of getCoord() where findValue() takes one per
+   * bisection.
+   *
+   * \param[in] object, value Same as for findValue(); they must be
+   *        what Astrobj::Generic::getEventFunction() returned;
+   * \param[in] index Index of the earliest end of the step;
+   * \param[out] t On success, a date within GYOTO_T_TOL of the
+   *        crossing where (*object)(getCoord(t)) < value, like
+   *        toutside on output of findValue().
+   * \return true if the crossing was located, false if no crossing
+   *        was detected in this step, in which case t is untouched
+   *        and findValue() should be used.
+   */
+  bool getEvent(Functor::Double_constDoubleArray* object, double value,
+		size_t index, double &t);
+
+ private:
+  /// Photon::event_func_ minus Photon::event_value_ at date t
+  /**
+   * t must lie between indices index and index+1. If interp, the
+   * position is taken on the cubic Hermite interpolant of the step
+   * rather than with getCoord().
+   */
+  double eventValue(size_t index, double t, bool interp);
+
+  /// Regula falsi (Illinois variant) for getEvent()
+  /**
+   * Refine the bracket [tin, tout] of a zero of eventValue(), with
+   * fin < 0 < fout, starting at date guess, until it is narrower
+   * than tol. Return the final tin.
+   */
+  double findEvent(size_t index, double tin, double fin,
+		   double tout, double fout, double guess, double tol,
+		   bool interp);
+
 #ifdef GYOTO_USE_XERCES
  public:
   /// Write XML description
@@ -262,8 +394,40 @@ class Gyoto::Photon : public Gyoto::Worldline, protected Gyoto::SmartPointee {
    */
   virtual void transmit(size_t i, double t);
 
+  /// Number of channels still active
+  /**
+   * Number of elements of Photon::transmission_ above
+   * transmissionCutoff(), i.e. of elements in getActiveChannels().
+   */
+  size_t getNActiveChannels() const ;
+
+  /// Get Photon::active_
+  /**
+   * Sorted indices of the channels whose transmission is still above
+   * transmissionCutoff(). Astrobj::Generic::processHitQuantities()
+   * only computes emission and transmission for those channels.
+   *
+   * The list shrinks as transmit() is called: callers which iterate
+   * over it while calling transmit() should do so from the end.
+   */
+  size_t const * getActiveChannels() const ;
+
+  /// Set Photon::transmission_cutoff_
+  /**
+   * A channel whose transmission drops to or below this value is
+   * removed from the list of active channels and does not receive
+   * any further contribution. Defaults to
+   * GYOTO_DEFAULT_TRANSMISSION_CUTOFF, the same threshold that
+   * stops the integration when reached in every channel. 0 keeps
+   * every channel until it is exactly opaque.
+   */
+  void transmissionCutoff(double cutoff);
+
+  /// Get Photon::transmission_cutoff_
+  double transmissionCutoff() const ;
+
  private:
-  /// Allocate Photon::transmission_
+  /// Allocate Photon::transmission_ and Photon::active_
   void _allocateTransmission();
 
  public:
@@ -298,6 +462,7 @@ class Gyoto::Photon::Refined : public Gyoto::Photon {
  public:
   Refined(Photon *parent, size_t i, int dir, double step_max);
   ///< Constructor
+  virtual ~Refined(); ///< Destructor, leaves the parent's arrays alone
   virtual void transmit(size_t i, double t);
   ///< Update transmission both in *this and in *parent_
 };
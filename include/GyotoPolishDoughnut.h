@@ -156,7 +156,10 @@ public:
  int Impact_(Photon *ph, size_t index,
 			    Astrobj::Properties *data);
  ///< A specific implementation of Generic::Impact()
+ virtual Functor::Double_constDoubleArray* getEventFunction(double &value);
+ ///< NULL if PolishDoughnut::use_specific_impact_, else as Standard
  virtual double operator()(double const coord[4]) ;
+ virtual int getSymmetries() const; ///< GYOTO_SYMMETRY_EQUATORIAL
 
  virtual int setParameter(std::string name,
 			  std::string content,
@@ -73,6 +73,15 @@ class Gyoto::Spectrum::PowerLaw : public Gyoto::Spectrum::Generic {
   using Gyoto::Spectrum::Generic::operator();
   virtual double operator()(double nu) const;
 
+  using Gyoto::Spectrum::Generic::integrate;
+  /**
+   * \brief Integrate optically thick I<SUB>&nu;</SUB> analytically
+   *
+   * constant_*(nu2<SUP>exponent_+1</SUP>-nu1<SUP>exponent_+1</SUP>)/(exponent_+1),
+   * or constant_*log(nu2/nu1) if exponent_ is -1.
+   */
+  virtual double integrate(double nu1, double nu2);
+
 #ifdef GYOTO_USE_XERCES
   virtual void setParameter(std::string name,
 			    std::string content,
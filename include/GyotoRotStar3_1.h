@@ -53,17 +53,26 @@ class Gyoto::Metric::RotStar3_1 : public Gyoto::Metric::Generic {
   friend class Gyoto::SmartPointer<Gyoto::Metric::RotStar3_1>;
 
  private:
+  /**
+   * \brief Lorene objects loaded from RotStar3_1::filename_
+   *
+   * Reading the file and solving for the Star_rot is expensive. The
+   * result is never modified afterwards: it is shared by all the
+   * clones of a RotStar3_1 (one per thread in Scenery::rayTrace()).
+   */
+  class LoreneStar;
   char* filename_; ///< Lorene output file name
-  Star_rot * star_; ///< Pointer to underlying Lorene Star_rot instance 
+  SmartPointer<LoreneStar> lorene_; ///< Shared Lorene objects
+  Star_rot const * star_; ///< Underlying Lorene Star_rot instance, in lorene_
   int integ_kind_;///< 1 if RotStar3_1::myrk4(), 0 if Metric::myrk4()
  
  public:
 
   RotStar3_1(); ///< Constructor
-  RotStar3_1(const RotStar3_1& ) ;                ///< Copy constructor
+  RotStar3_1(const RotStar3_1& ) ;                ///< Copy constructor: shares the Lorene objects
   virtual ~RotStar3_1() ;        ///< Destructor
   virtual RotStar3_1* clone() const ;
-           ///< Cloner (uses RotStar3_1(file, integ_kind))
+           ///< Cloner (cheap, see RotStar3_1::lorene_)
 
   void setFileName(char const *); ///< Set filename_
   char const * getFileName() const; ///< Get filename_
@@ -125,7 +134,7 @@ class Gyoto::Metric::RotStar3_1 : public Gyoto::Metric::Generic {
   double ScalarProd(const double pos[4],
 		    const double u1[4], const double u2[4]) const ;
 
-  virtual void setParameter(std::string, std::string, std::string);
+  virtual int setParameter(std::string, std::string, std::string);
 #ifdef GYOTO_USE_XERCES
   virtual void fillElement(FactoryMessenger *fmp); ///< called from Factory
   virtual void setParameters(Gyoto::FactoryMessenger *fmp) ;
@@ -65,6 +65,9 @@ namespace Gyoto{
  * - FirstDistMin: last closest approach between Photon and Astrobj;
  * - Redshift;
  * - ImpactCoords: 8-coordinates of the object and photon at impact;
+ * - TransferFunction: 8-coordinates of the object and photon at
+ *        each crossing of a ThinDisk, see
+ *        GYOTO_QUANTITY_TRANSFERFUNCTION;
  * - Spectrum: I<SUB>&nu;</SUB> computed at various values frequencies,
  *        corresponding to the Screen's Spectrometer.
  * - BinSpectrum:
@@ -81,6 +84,29 @@ namespace Gyoto{
  * actual number of cores available on the machine usually leads to a
  * decrease in performance.
  *
+ * If the UseSymmetries entity is present and the scene is seen
+ * edge-on, the photons which are the mirror images of other photons
+ * through the equatorial plane are not integrated: the corresponding
+ * pixels are copied instead, see Scenery::usesym_.
+ *
+ * If the PacketTracing entity is present, each thread integrates
+ * GYOTO_PACKET_SIZE neighbouring photons at a time, sharing the
+ * integrator steps in a Metric::KerrBL, see Scenery::packet_.
+ *
+ * If the RegionOfInterest entity is present, the pixels which
+ * cannot see the Astrobj are not ray-traced but set to the
+ * background values, see Scenery::roi_. Its optional content is
+ * a safety margin, see Scenery::roimargin_.
+ *
+ * If the AnalyticFarField entity is present, the photons do not
+ * start on the Screen but where they first reach the Astrobj's rmax,
+ * when the Metric knows how to get them there without integrating,
+ * see Scenery::farfield_.
+ *
+ * When computing spectra, a channel whose transmission drops to or
+ * below TransmissionCutoff (default 1e-6) is no longer computed, see
+ * Scenery::transmission_cutoff_.
+ *
  * Thus a fully populated Scenery XML looks like that:
  * \code
  * <?xml version="1.0" encoding="UTF-8" standalone="no"?>
@@ -104,6 +130,16 @@ namespace Gyoto{
  *
  *  <NThreads> 2 </NThreads>  
  *
+ *  <UseSymmetries/>
+ *
+ *  <PacketTracing/>
+ *
+ *  <RegionOfInterest> 2. </RegionOfInterest>
+ *
+ *  <AnalyticFarField/>
+ *
+ *  <TransmissionCutoff> 1e-6 </TransmissionCutoff>
+ *
  * </Scenery>
  * \endcode
  */
@@ -177,6 +213,55 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
 
   size_t maxiter_ ; ///< Maximum number of iterations when integrating
 
+  /// See Photon::transmissionCutoff(double)
+  double transmission_cutoff_;
+
+  /**
+   * If true, rayTrace() does not integrate the photons which are the
+   * mirror images of other photons in the same field, see
+   * Screen::getMirror(), Metric::Generic::getSymmetries() and
+   * Astrobj::Generic::getSymmetries().
+   */
+  bool usesym_; ///< Whether to exploit the symmetries of the scene
+
+  /**
+   * If true, rayTrace() integrates GYOTO_PACKET_SIZE neighbouring
+   * photons at a time in each thread, see Photon::hit(size_t n,
+   * Photon * const ph[], Astrobj::Properties * const data[], int
+   * hitt[]). The photons of a packet only share their integration
+   * steps in a Metric::KerrBL. Not used with pre-computed impact
+   * coordinates or transfer functions.
+   */
+  bool packet_; ///< Whether to trace photons in packets
+
+  /**
+   * If true, the initial condition of each photon is moved from the
+   * Screen to the sphere of radius Astrobj::Generic::getRmax() using
+   * Metric::Generic::propagateFarField(), so that the integrator does
+   * not spend steps in the empty far field. Not used with
+   * pre-computed impact coordinates or transfer functions.
+   */
+  bool farfield_; ///< Whether to start photons analytically at rmax
+
+  /**
+   * If true, rayTrace() does not integrate the photons which cannot
+   * come within Astrobj::Generic::getRmax() of the centre: their
+   * cells are set by Astrobj::Properties::init(), exactly like for a
+   * photon escaping to infinity. The photons are selected by their
+   * impact parameter, see Screen::mayApproach(). The bound is that
+   * of a Schwarzschild metric of the same mass, plus
+   * Scenery::roimargin_. Not used with pre-computed impact
+   * coordinates or transfer functions.
+   */
+  bool roi_; ///< Whether to skip the pixels which cannot see the Astrobj
+
+  /**
+   * Added to the bound on the impact parameter of the photons which
+   * may reach the Astrobj, in geometrical units. Default:
+   * GYOTO_DEFAULT_ROI_MARGIN.
+   */
+  double roimargin_; ///< Safety margin for Scenery::roi_
+
   // Constructors - Destructor
   // -------------------------
  public:
@@ -259,6 +344,29 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
   void maxiter (size_t miter) ; ///< Set Scenery::maxiter_
   size_t maxiter () const ; ///< Get Scenery::maxiter_
 
+  /// Set Scenery::transmission_cutoff_
+  /**
+   * Spectral channels whose transmission drops to or below this
+   * value stop being computed, see Photon::transmissionCutoff(double).
+   */
+  void transmissionCutoff (double cutoff) ;
+  double transmissionCutoff () const ; ///< Get Scenery::transmission_cutoff_
+
+  void useSymmetries (bool mode) ; ///< Set Scenery::usesym_
+  bool useSymmetries () const ; ///< Get Scenery::usesym_
+
+  void packetTracing (bool mode) ; ///< Set Scenery::packet_
+  bool packetTracing () const ; ///< Get Scenery::packet_
+
+  void analyticFarField (bool mode) ; ///< Set Scenery::farfield_
+  bool analyticFarField () const ; ///< Get Scenery::farfield_
+
+  void regionOfInterest (bool mode) ; ///< Set Scenery::roi_
+  bool regionOfInterest () const ; ///< Get Scenery::roi_
+
+  void regionOfInterestMargin (double margin) ; ///< Set Scenery::roimargin_
+  double regionOfInterestMargin () const ; ///< Get Scenery::roimargin_
+
   void setNThreads(size_t); ///< Set nthreads_;
   size_t getNThreads() const ; ///< Get nthreads_;
 
@@ -278,9 +386,9 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
 
   // Worker:
  public:
-  /// Perform ray-tracing for a square area on Screen
+  /// Perform ray-tracing for a rectangular area on Screen
   /**
-   * For each Scenery::screen_ pixel in the square area limited by
+   * For each Scenery::screen_ pixel in the rectangular area limited by
    * imin, imax, jmin and jmax, launch a Photon back in time to
    * compute the various quantities.
    *
@@ -288,13 +396,18 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
    * in *data which are not NULL.
    *
    * rayTrace() uses
-   * - setPropertyConverters() to set the converters in *data;
+   * - setPropertyConverters() to set the converters in *data. When a
+   *   conversion is a mere scaling (Units::Converter::isLinear()),
+   *   it is not applied to each increment during the ray-tracing but
+   *   once to the final arrays;
    * - Astrobj::Properties::init() to initialize each cell in *data;
    * - Astrobj::Properties::operator++() to step through the arrays in *data.
    *
    * data must have been instanciated prior to calling rayTrace and
    * the various pointers in *data must be NULL or point to the first
-   * cell in an array of size at least Screen::npix_ squared.
+   * cell in an array of (imax-imin+1)*(jmax-jmin+1) cells, after
+   * clipping imax and jmax to the horizontal and vertical
+   * resolutions of the Screen.
    *
    * If Scenery::nthreads_ is &ge;2 and Gyoto has been compiled with
    * pthreads support, rayTrace() will use Scenery::nthreads_ threads
@@ -304,6 +417,15 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
    * metric kind, and if they are both thread-safe. At the moment,
    * unfortunately, Lorene metrics are known to not be thread-safe.
    *
+   * If Scenery::usesym_ is true and Screen::getMirror() finds that
+   * some pixels in the field are mirror images of others, only one
+   * pixel of each pair is ray-traced and the other one is
+   * copied. ImpactCoords and TransferFunction are reflected through
+   * the equatorial plane accordingly.
+   *
+   * If Scenery::roi_ is true, the pixels which cannot see the Astrobj
+   * are only initialized.
+   *
    * \param[in] imin, imax, jmin, jmax First and last rows and columns in
    * Scenery::screen_ to compute
 
@@ -319,9 +441,19 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
    * for which the shape of the object is identical but their emission
    * distributions are not. impactcoords can be computed using the
    * ImpactCoords quantity.
+   *
+   * \param[in] transferfunction Optional pointer to an array of
+   * pre-computed transfer functions (GYOTO_TRANSFER_SIZE doubles per
+   * pixel). Similar to impactcoords, but for all the crossings of a
+   * thin disk, in optically thick or optically thin mode: the
+   * quantities in *data are computed by
+   * Astrobj::ThinDisk::processTransferFunction() without
+   * ray-tracing. The Astrobj must be a ThinDisk. transferfunction
+   * can be computed using the TransferFunction quantity.
    */
   void rayTrace(size_t imin, size_t imax, size_t jmin, size_t jmax,
-		Astrobj::Properties* data, double * impactcoords = NULL);
+		Astrobj::Properties* data, double * impactcoords = NULL,
+		double * transferfunction = NULL);
 
 
   /// Ray-trace a single pixel in Scenery::screen_
@@ -333,7 +465,73 @@ class Gyoto::Scenery : protected Gyoto::SmartPointee {
    * &Scenery::ph_.
    */
   void operator() (size_t i, size_t j, Astrobj::Properties *data,
-		   double * impactcoords = NULL, Photon * ph = NULL);
+		   double * impactcoords = NULL, Photon * ph = NULL,
+		   double * transferfunction = NULL);
+
+  /// Perform ray-tracing for a list of sky positions
+  /**
+   * Like rayTrace() above, but for arbitrary directions instead of
+   * a block of pixels: ray k is launched towards sky[2*k] and
+   * sky[2*k+1], which are passed to Screen::getRayCoord(double x,
+   * double y, double coord[]) (for the default equatorial screen
+   * angles: RA offset &alpha; and Dec offset &delta;, in radians).
+   *
+   * The rays are distributed among Scenery::nthreads_ threads as
+   * the pixels of an image. The quantities for ray k are stored in
+   * cell k of the arrays in *data, which must hold at least nrays
+   * cells.
+   *
+   * \param[in] nrays number of rays;
+   * \param[in] sky array of 2*nrays doubles (&alpha;, &delta;);
+   * \param[in, out] data as in rayTrace() above.
+   */
+  void rayTrace(size_t nrays, double const * sky,
+		Astrobj::Properties* data);
+
+  /// Ray-trace a single sky position
+  /**
+   * As operator()(size_t i, size_t j, ...), for the direction given
+   * by sky[0] and sky[1] as in rayTrace(size_t nrays, double const *
+   * sky, Astrobj::Properties* data).
+   */
+  void operator() (double const sky[2], Astrobj::Properties *data,
+		   Photon * ph = NULL);
+
+  /// Ray-trace a packet of pixels or sky positions
+  /**
+   * As operator()(size_t i, size_t j, ...) for n &le;
+   * GYOTO_PACKET_SIZE rays, integrated together by Photon::hit(size_t
+   * n, Photon * const ph[], Astrobj::Properties * const data[], int
+   * hitt[]). Ray k is launched towards pixel (ij[2*k], ij[2*k+1]) if
+   * sky is NULL, towards sky position (sky[2*k], sky[2*k+1])
+   * otherwise. Its quantities are stored in data[k]. Each ph[k] must
+   * have been initialized as when passed to operator()(size_t i,
+   * size_t j, ...).
+   */
+  void operator() (size_t n, size_t const * ij, double const * sky,
+		   Astrobj::Properties *data, Photon * const ph[]);
+
+ private:
+  /// Common part of the two rayTrace() methods
+  /**
+   * If sky is NULL, trace pixels imin to imax and jmin to jmax
+   * (already clipped to the Screen). Else, trace the sky positions
+   * imin to imax in sky (jmin and jmax should be 1).
+   */
+  void rayTraceCells(size_t imin, size_t imax, size_t jmin, size_t jmax,
+		     double const * sky, Astrobj::Properties* data,
+		     double * impactcoords, double * transferfunction);
+
+  /// Common part of the two operator()
+  /**
+   * coord is the initial condition of the Photon, ignored if
+   * impactcoords or transferfunction is not NULL.
+   */
+  void traceRay(double coord[8], Astrobj::Properties *data,
+		double * impactcoords, Photon * ph,
+		double * transferfunction);
+
+ public:
 
 #ifdef GYOTO_USE_XERCES
  public:
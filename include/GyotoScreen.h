@@ -59,7 +59,8 @@ namespace Gyoto {
  *     change to seconds in a future version);
  *   - the field-of-view of the image;
  *   - the resolution of the camera: number of pixels on each side
- *     (the camera is square);
+ *     (the camera is square unless a vertical resolution and
+ *     field-of-view are given, see below);
  *   - the observing frequency.
  *
  * The scalar FreqObs defines the observing frequency for Scenery
@@ -103,6 +104,17 @@ namespace Gyoto {
  * \endcode
  *
  *
+ * Rectangular screens are obtained by giving two numbers of pixels,
+ * horizontal (along the first, i, axis) then vertical (along j), in
+ * Resolution. Pixels are square by default; VerticalFieldOfView
+ * (with the same units as FieldOfView) sets an independent vertical
+ * pixel scale:
+ * \code
+ *    <FieldOfView>          0.3 </FieldOfView>
+ *    <VerticalFieldOfView>  0.1 </VerticalFieldOfView>
+ *    <Resolution>      256  128 </Resolution>
+ * \endcode
+ *
  * Units can be specified using the unit attribute in the XML file,
  * for instance:
  * 
@@ -141,9 +153,11 @@ class Gyoto::Screen : protected Gyoto::SmartPointee {
 
  private:
   double tobs_; ///< Observing date in s
-  double fov_;  ///< Field-of-view in rad
+  double fov_;  ///< Field-of-view in rad (horizontal)
+  double fovv_; ///< Vertical field-of-view in rad, 0. for square pixels
   //  double tmin_;
-  size_t npix_; ///< Resolution in pixels
+  size_t npix_; ///< Resolution in pixels (horizontal)
+  size_t npixv_; ///< Vertical resolution in pixels
 
   double distance_; ///< Distance to the observer in m
   double dmax_; ///< Maximum distance from which the photons are launched (geometrical units) 
@@ -181,6 +195,12 @@ class Gyoto::Screen : protected Gyoto::SmartPointee {
    */
   double freq_obs_;
 
+  /// Convert an angle in unit to radians, see setFieldOfView()
+  double angleToRad(double angle, const std::string &unit) const;
+
+  /// Convert an angle in radians to unit, see getFieldOfView()
+  double angleFromRad(double angle, const std::string &unit) const;
+
  public:
    
   // Constructors - Destructor
@@ -370,6 +390,24 @@ class Gyoto::Screen : protected Gyoto::SmartPointee {
   /// Set Screen::fov_ in specified unit
   void setFieldOfView(double, const std::string &unit);
 
+  /// Get vertical field-of-view in radians
+  /**
+   * Screen::fovv_ if set, else the value yielding square pixels.
+   */
+  double getVerticalFieldOfView();
+
+  /// Get vertical field-of-view in specified unit
+  double getVerticalFieldOfView(std::string unit);
+
+  /// Set Screen::fovv_ in radians
+  /**
+   * 0. restores square pixels.
+   */
+  void setVerticalFieldOfView(double);
+
+  /// Set Screen::fovv_ in specified unit
+  void setVerticalFieldOfView(double, const std::string &unit);
+
   /// Set direction of the line-of-view
   void setAlpha0(double);
   /// Set direction of the line-of-view
@@ -380,8 +418,12 @@ class Gyoto::Screen : protected Gyoto::SmartPointee {
 
   /// Get Screen::npix_
   size_t getResolution();
-  /// Set Screen::npix_
+  /// Get Screen::npixv_
+  size_t getVerticalResolution();
+  /// Set Screen::npix_ and Screen::npixv_ (square screen)
   void setResolution(size_t);
+  /// Set Screen::npix_ and Screen::npixv_
+  void setResolution(size_t horizontal, size_t vertical);
 
   /// 4-Position of the observer relative to the metric
   /**
@@ -443,6 +485,48 @@ class Gyoto::Screen : protected Gyoto::SmartPointee {
    * 
    */
   void getRayCoord(const size_t i, const size_t j, double coord[]) const;
+
+  /// Which pixels are mirror images of each other
+  /**
+   * When the scene (Metric and Astrobj) is symmetric with respect to
+   * the equatorial plane and the Screen sees it edge-on, with the
+   * projected equator along one of the pixel axes, the photons
+   * reaching pixels (i, j) and their mirror image are the mirror
+   * images of each other.
+   *
+   * This is only detected for the default, static observer using
+   * equatorial screen angles. The projected equator is along the i
+   * axis when PALN is a multiple of pi (the mirror then requires
+   * delta0=0), along the j axis when PALN is an odd multiple of pi/2
+   * (the mirror then requires alpha0=0).
+   *
+   * \param[in] symmetries bitwise OR of GYOTO_SYMMETRY_* flags
+   * satisfied by the scene;
+   * \return GYOTO_SCREEN_MIRROR_I, GYOTO_SCREEN_MIRROR_J or 0.
+   */
+  int getMirror(int symmetries) const;
+
+  /// Whether a ray may come within some impact parameter
+  /**
+   * Conservative test used to skip the pixels which cannot see an
+   * object of known extent. The photon received from direction
+   * (alpha, delta) has, in the weak field of the observer, an impact
+   * parameter b at least r sin(theta), r being the distance at which
+   * getRayCoord() launches it and theta the angle between its
+   * direction and that of the centre of the Metric.
+   *
+   * This is only decided for the default, static observer using
+   * equatorial screen angles, when the field does not extend towards
+   * the back of the observer. In all other cases, true is returned.
+   *
+   * \param alpha, delta sky direction as in getRayCoord();
+   * \param bmax impact parameter in geometrical units;
+   * \return false if the photon certainly has b > bmax.
+   */
+  bool mayApproach(double alpha, double delta, double bmax) const;
+
+  /// Same as mayApproach(double, double, double) for a pixel
+  bool mayApproach(size_t i, size_t j, double bmax) const;
   
   void coordToSky(const double pos[4], double skypos[3]) const;
   ///< Convert 4-position to 3-sky position
@@ -479,6 +563,22 @@ class Gyoto::Screen : protected Gyoto::SmartPointee {
 # endif
 
 
+ public:
+  /// Set a parameter by name, as in the XML description
+  /**
+   * Accepts the scalar XML elements of a Screen (e.g. Time,
+   * Distance, Inclination, FieldOfView, Resolution...), not the
+   * Spectrometer. Parameters are applied immediately, in the order
+   * they are set.
+   *
+   * \param name XML name of the parameter;
+   * \param content string representation of the value;
+   * \param unit unit of the value, "" for the default.
+   * \return 0 if the parameter was recognized, 1 otherwise.
+   */
+  int setParameter(std::string name, std::string content,
+		   std::string unit="");
+
 #ifdef GYOTO_USE_XERCES
  public:
     void fillElement(FactoryMessenger *fmp); ///< called from Factory
@@ -151,6 +151,12 @@ class Gyoto::Spectrum::Generic : protected Gyoto::SmartPointee {
    *
    * See operator()(double nu) const
    *
+   * The generic implementation first tries 4- and 8-point
+   * Gauss-Legendre quadratures. If they agree to better than 1%,
+   * which is the case for all smooth spectra over a reasonable band,
+   * the latter is returned. Else, the trapezoidal rule is iteratively
+   * refined until it reaches this accuracy.
+   *
    * \param nu1, nu2 boundaries for the integration
    * \result I, the integral of I_nu between nu1 and nu2
    */
@@ -159,7 +165,8 @@ class Gyoto::Spectrum::Generic : protected Gyoto::SmartPointee {
   /**
    * \brief Integrate optically thin I_nu
    *
-   * See operator()(double nu, double opacity, double ds) const
+   * See operator()(double nu, double opacity, double ds) const and
+   * integrate(double nu1, double nu2).
    *
    * \param nu1, nu2 boundaries for the integration
    * \param opacity the frequency-dependent opacity law given as a
@@ -170,6 +177,35 @@ class Gyoto::Spectrum::Generic : protected Gyoto::SmartPointee {
   virtual double integrate(double nu1, double nu2,
 			   const Spectrum::Generic * opacity, double ds) ;
 
+  /**
+   * \brief Integrate optically thick I_nu in each channel
+   *
+   * Same as integrate(double nu1, double nu2) for each channel of a
+   * Spectrometer, in one call. Arguments follow
+   * Astrobj::Generic::integrateEmission(double * I, double const *
+   * boundaries, size_t const * chaninds, size_t nbnu, double dsem,
+   * double *cph, double *co) const.
+   *
+   * \param I[nbnu] output, must be allocated by the caller
+   * \param boundaries channel boundaries in Hz
+   * \param chaninds[2*nbnu] indices in boundaries of each channel
+   * \param nbnu number of channels
+   */
+  virtual void integrate(double * I, double const * boundaries,
+			 size_t const * chaninds, size_t nbnu) ;
+
+  /**
+   * \brief Integrate optically thin I_nu in each channel
+   *
+   * Same as integrate(double nu1, double nu2, const
+   * Spectrum::Generic * opacity, double ds) for each channel of a
+   * Spectrometer. See integrate(double * I, double const *
+   * boundaries, size_t const * chaninds, size_t nbnu).
+   */
+  virtual void integrate(double * I, double const * boundaries,
+			 size_t const * chaninds, size_t nbnu,
+			 const Spectrum::Generic * opacity, double ds) ;
+
 #ifdef GYOTO_USE_XERCES
   /**
    * Spectrum implementations should impement fillElement to save their
@@ -94,6 +94,17 @@ class Gyoto::Astrobj::Standard :
   double critical_value_; ///< See operator()(double const coord[4])
   double safety_value_; ///< See operator()(double const coord[4])
 
+  /// A point of the worldline sampled by Impact()
+  struct ImpactSample {
+    double cph[8]; ///< Photon coordinates
+    double coh[8]; ///< Fluid coordinates and velocity
+    int inside; ///< Whether cph is inside the object
+    double dt; ///< Coordinate time step em and tr are computed over
+    double em; ///< emission() over dt, 0 outside
+    double tr; ///< transmission() over dt, 1 outside
+    double f; ///< Redshifted em per unit coordinate time
+  };
+
   // Constructors - Destructor
   // -------------------------
  public:
@@ -131,6 +142,9 @@ class Gyoto::Astrobj::Standard :
   virtual int Impact(Gyoto::Photon* ph, size_t index,
 		     Astrobj::Properties *data=NULL)  ;
 
+  /// Return this with value=critical_value_
+  virtual Functor::Double_constDoubleArray* getEventFunction(double &value);
+
   /**
    * \brief Function defining the object interior
    *
@@ -154,16 +168,65 @@ class Gyoto::Astrobj::Standard :
   virtual void getVelocity(double const pos[4], double vel[4]) = 0 ;
 
   /**
-   * \brief Maximum &delta; inside object
+   * \brief Minimum &delta; inside object
    *
    * Gives the requested integration step &delta;<SUB>t</SUB> (in
    * coordinate time t) between two neighbooring points along a
-   * portion of geodesic inside an astrobj
+   * portion of geodesic inside an astrobj. Impact() refines its
+   * quadrature down to this step where the emission varies, and
+   * uses steps up to GYOTO_STANDARD_MAXSTEP times larger where it is
+   * smooth.
    *
    * \param coord input coordinate at which &delta;<SUB>t</SUB> is given
    */
   virtual double giveDelta(double coord[8]);
 
+ protected:
+  /// Compute an ImpactSample at date t
+  /**
+   * \param ph Photon being traced;
+   * \param t date of the sample;
+   * \param delta step for which the emission is evaluated;
+   * \param[out] s the sample.
+   */
+  void sampleImpact(Gyoto::Photon* ph, double t, double delta,
+		    ImpactSample &s);
+
+  /// Adaptive Simpson quadrature of one interval for Impact()
+  /**
+   * Splits [a, b] until the Simpson estimate of the emission and the
+   * optical depth of each piece are under control, then feeds the
+   * Simpson nodes of each piece, in order of decreasing date, to
+   * processHitQuantities() with their quadrature weight as
+   * integration step.
+   *
+   * \param ph, data as in Impact();
+   * \param a, m, b samples at the beginning, middle and end;
+   * \param whole Simpson estimate over [a, b];
+   * \param delta giveDelta(), smallest interval considered;
+   * \param pending,weight node shared with the previous piece and
+   * its weight so far (0 if none).
+   */
+  void integrateImpact(Gyoto::Photon* ph, Astrobj::Properties *data,
+		       ImpactSample const &a, ImpactSample const &m,
+		       ImpactSample const &b, double whole, double delta,
+		       ImpactSample &pending, double &weight);
+
+  /// Feed one sample to processHitQuantities()
+  /**
+   * With radiative transfer, emission() is not called again: s.em
+   * is rescaled from s.dt to dt as the emission of a homogeneous
+   * slab, S*(1-s.tr^(dt/s.dt)), and passed on through
+   * Generic::hit_emission_. This is exact for emission() and
+   * transmission() of the form S*(1-exp(-&alpha;*dsem)) and
+   * exp(-&alpha;*dsem), and reduces to dt/s.dt*s.em without
+   * absorption.
+   */
+  void processSample(Gyoto::Photon* ph, Astrobj::Properties *data,
+		     ImpactSample const &s, double dt);
+
+ public:
+
   virtual int setParameter(std::string name,
 			   std::string content,
 			   std::string unit = "") ;
@@ -97,6 +97,29 @@ class Gyoto::Astrobj::Star :
   
   // Data : 
   // -----
+ protected:
+  /**
+   * \brief Orbit sampled at regular dates
+   *
+   * The Worldline is integrated lazily, with an adaptive step, and
+   * Worldline::getCoord() needs a binary search and two RK4 steps
+   * per date. UniformSphere::operator()() needs the position of the
+   * Star for each of the many dates tried by Standard::Impact().
+   *
+   * Instead, the position of the Star and its time derivative are
+   * sampled on a regular grid of dates, by chunks of
+   * GYOTO_STAR_CHUNK steps computed on demand, and interpolated
+   * using cubic Hermite polynomials. The table is shared by the
+   * clones of a Star (one per thread in Scenery::rayTrace()): each
+   * chunk is computed only once, and only the sampling setup and
+   * the lookup and insertion of chunks need a lock.
+   */
+  class OrbitTable;
+  SmartPointer<OrbitTable> orbit_; ///< Shared orbit table, reset by reInit()
+  double const * chunk_; ///< Last chunk of orbit_ used by this instance
+  long chunkidx_; ///< Index of chunk_ in orbit_
+  double t0_; ///< Copy of orbit_->t0, read under lock
+  double dt_; ///< Copy of orbit_->dt, read under lock, 0. until first use
 
   // Constructors - Destructor
   // -------------------------
@@ -178,6 +201,31 @@ class Gyoto::Astrobj::Star :
 		double * const yprime=NULL,  double * const zprime=NULL) ;
   virtual void getVelocity(double const pos[4], double vel[4]) ;
 
+  /// Reset integration and forget Star::orbit_
+  virtual void reInit() ;
+
+  // The integration parameters also affect Star::orbit_: these
+  // call reInit()
+  virtual void setDelta(const double delta);
+  using Worldline::setDelta;
+  virtual void setTmin(double tlim);
+  virtual void adaptive (bool mode) ;
+  using Worldline::adaptive;
+  virtual void maxiter (size_t miter) ;
+  using Worldline::maxiter;
+
+ protected:
+  /// Interpolate position and coordinate velocity in Star::orbit_
+  /**
+   * \param[in] date coordinate time;
+   * \param[out] pos 4-position at date;
+   * \param[out] prime dx<SUP>i</SUP>/dt at date.
+   * \return false if the chunk containing date could not be computed
+   * (e.g. the Star has fallen into the horizon), in which case the
+   * caller must fall back to Worldline::getCoord().
+   */
+  bool getOrbitCoord(double date, double pos[4], double prime[3]);
+
 };
 
 
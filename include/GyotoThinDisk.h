@@ -141,6 +141,14 @@ class Gyoto::Astrobj::ThinDisk :
    */
   virtual void getVelocity(double const pos[4], double vel[4])  ;
 
+  /**
+   * A ThinDisk is symmetric with respect to the equatorial plane as
+   * long as its emission and velocity only depend on the crossing
+   * point, which is the case of all the ThinDisk kinds distributed
+   * with Gyoto.
+   */
+  virtual int getSymmetries() const; ///< GYOTO_SYMMETRY_EQUATORIAL
+
  public:
   virtual int setParameter(std::string name,
 			   std::string content,
@@ -157,9 +165,48 @@ class Gyoto::Astrobj::ThinDisk :
 #endif
 
   public:
+  /**
+   * In addition to the generic behaviour, if data->transferfunction
+   * is not NULL, each crossing of the equatorial plane is saved there
+   * (see GYOTO_QUANTITY_TRANSFERFUNCTION) so that the image can later
+   * be re-shaded using processTransferFunction().
+   */
   virtual int Impact(Gyoto::Photon* ph, size_t index,
 		     Astrobj::Properties *data=NULL) ;
 
+  /// Return this with value=0: the equatorial plane
+  virtual Functor::Double_constDoubleArray* getEventFunction(double &value);
+
+  /// Re-shade a pixel from a saved transfer function
+  /**
+   * Replays each crossing stored in tf (as saved by Impact() in
+   * Properties::transferfunction) through processHitQuantities(),
+   * in the same order as during ray-tracing, without integrating the
+   * geodesic again. The geometry (crossing positions, fluid velocity
+   * and dt) is the one saved in tf: only parameters which affect
+   * emission() and transmission() may change between the
+   * ray-tracing and the re-shading. Crossings which were not reached
+   * during the ray-tracing (because the Photon had been fully
+   * absorbed) are not available.
+   *
+   * \param ph Photon, must have its Spectrometer and transmissions
+   *        initialized;
+   * \param tf GYOTO_TRANSFER_SIZE doubles for this pixel;
+   * \param data where to store the observable quantities.
+   */
+  virtual void processTransferFunction(Gyoto::Photon* ph, double const * tf,
+				       Astrobj::Properties *data) const;
+
+ protected:
+  /// Fill data for one crossing
+  /**
+   * Fills the User1, User2 and User3 quantities (date, radius and
+   * longitude of the crossing) and calls processHitQuantities().
+   */
+  virtual void processCrossing(Gyoto::Photon* ph, double* coord_ph_hit,
+			       double* coord_obj_hit, double dt,
+			       Astrobj::Properties* data) const;
+
 };
 
 
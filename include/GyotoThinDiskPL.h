@@ -51,6 +51,9 @@ namespace Gyoto{
  *  - PLSlope: ThinDiskPL::PLSlope_
  *  - PLRho: ThinDiskPL::PLRho_
  *  - PLRadRef: ThinDiskPL::PLRadRef_
+ *
+ * The temperature is then T = C r<SUB>cur</SUB><SUP>2&alpha;/3</SUP>,
+ * where C is computed each time a parameter changes.
  */
 class Gyoto::Astrobj::ThinDiskPL : public Astrobj::ThinDisk {
   friend class Gyoto::SmartPointer<Gyoto::Astrobj::ThinDiskPL>;
@@ -58,6 +61,8 @@ class Gyoto::Astrobj::ThinDiskPL : public Astrobj::ThinDisk {
   double PLSlope_; ///< Power law index
   double PLRho_; ///< Reference density
   double PLRadRef_; ///< Reference radius
+  double temperature_coef_; ///< Temperature (K) at r<SUB>cur</SUB>=1
+  double temperature_index_; ///< Power law index of the temperature
  protected:
   SmartPointer<Spectrum::BlackBody> spectrumBB_; ///< disk black body
 
@@ -79,12 +84,26 @@ class Gyoto::Astrobj::ThinDiskPL : public Astrobj::ThinDisk {
   virtual double emission(double nu_em, double dsem,
 			  double c_ph[8],double c_obj[8]) const;
 
+  /**
+   * The temperature is computed only once for all the frequencies.
+   */
+  virtual void emission(double Inu[], double nu_em[], size_t nbnu,
+			double dsem, double c_ph[8], double c_obj[8]) const;
+
  private:
   /**
    * \brief emission() helper
    */
   double emissionBB(double nu, double co[8]) const;
 
+  /**
+   * \brief Temperature (K) of the disk at position co
+   */
+  double temperature(double co[8]) const;
+
+  /// Compute temperature_coef_ and temperature_index_ from the parameters
+  void foldConstants();
+
  public:
   int setParameter(std::string name, std::string content, std::string unit);
 #ifdef GYOTO_USE_XERCES
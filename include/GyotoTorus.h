@@ -157,6 +157,7 @@ class Gyoto::Astrobj::Torus : public Gyoto::Astrobj::Standard {
   // -------
  public:
   virtual double operator()(double const coord[4]) ;
+  virtual int getSymmetries() const; ///< GYOTO_SYMMETRY_EQUATORIAL
   
  protected:
   virtual void getVelocity(double const pos[4], double vel[4]) ;
@@ -167,6 +168,14 @@ class Gyoto::Astrobj::Torus : public Gyoto::Astrobj::Standard {
   using Standard::integrateEmission;
   virtual double integrateEmission(double nu1, double nu2, double dsem,
 				   double c_ph[8], double c_obj[8]=NULL) const;
+  /**
+   * All channels are integrated in one call to
+   * Spectrum::Generic::integrate(double * I, double const *
+   * boundaries, size_t const * chaninds, size_t nbnu).
+   */
+  virtual void integrateEmission(double * I, double const * boundaries,
+				 size_t const * chaninds, size_t nbnu,
+				 double dsem, double *cph, double *co) const;
 
   virtual double transmission(double nuem, double dsem, double coord[8]) const ;
   
@@ -186,6 +186,14 @@ class Gyoto::Astrobj::UniformSphere :
   using Standard::integrateEmission;
   virtual double integrateEmission(double nu1, double nu2, double dsem,
 				   double c_ph[8], double c_obj[8]=NULL) const;
+  /**
+   * All channels are integrated in one call to
+   * Spectrum::Generic::integrate(double * I, double const *
+   * boundaries, size_t const * chaninds, size_t nbnu).
+   */
+  virtual void integrateEmission(double * I, double const * boundaries,
+				 size_t const * chaninds, size_t nbnu,
+				 double dsem, double *cph, double *co) const;
   virtual double transmission(double nuem, double dsem, double*) const ;
   ///< Transmission is determined by opacity_
 
@@ -33,6 +33,7 @@
 namespace Gyoto {
   class Worldline;
   class FactoryMessenger;
+  namespace Metric { class KerrBL; }
 }
 
 #include <GyotoSmartPointer.h>
@@ -134,7 +135,7 @@ class Gyoto::Worldline
   virtual void setVelocity(double vel[3]); ///< Set initial 3-velocity
 
   void reset() ; ///< Forget integration, keeping initial contition
-  void reInit() ; ///< Reset and recompute particle properties
+  virtual void reInit() ; ///< Reset and recompute particle properties
 
   virtual std::string className() const ; ///< "Worldline"
   virtual std::string className_l() const ; ///< "worldline"
@@ -170,15 +171,15 @@ class Gyoto::Worldline
  public:
   /// Assignment to another Worldline
   void operator=(const Worldline&) ;        
-  void setDelta(const double delta); ///< Set delta
+  virtual void setDelta(const double delta); ///< Set delta
   void setDelta(double, const std::string &unit);   ///< Set default step in specified units
   double getDelta() const ; ///< Get delta
   double getDelta(const std::string &unit) const ;  ///< Get default step in specified units
   double getTmin() const ; ///< Get tmin value
-  void setTmin(double tlim); ///< Set tmin to a given value
-  void adaptive (bool mode) ; ///< Set adaptive_
+  virtual void setTmin(double tlim); ///< Set tmin to a given value
+  virtual void adaptive (bool mode) ; ///< Set adaptive_
   bool adaptive () const ; ///< Get adaptive_
-  void maxiter (size_t miter) ; ///< Set maxiter_
+  virtual void maxiter (size_t miter) ; ///< Set maxiter_
   size_t maxiter () const ; ///< Get maxiter_
 
   /**
@@ -419,7 +420,33 @@ class Gyoto::Worldline::IntegState : SmartPointee {
    */
   virtual int nextStep(double *coord);
 
+  /// Make one step for a packet of IntegState instances
+  /**
+   * Same as calling nextStep(coord[l]) for each lane l in which
+   * active[l] is set, except that the adaptive steps are computed in
+   * lockstep by the packet integrator of Metric::KerrBL. All the
+   * IntegState instances must integrate in gg.
+   *
+   * \param n Number of lanes, at most GYOTO_PACKET_SIZE;
+   * \param state IntegState of each lane;
+   * \param[out] coord Next position-velocity of each lane;
+   * \param active Whether to make a step in each lane;
+   * \param[out] ret What nextStep() returns, for each active lane;
+   * \param gg The Metric.
+   */
+  static void nextStep(size_t n, IntegState * const state[],
+		       double * const coord[], int const active[], int ret[],
+		       Gyoto::Metric::KerrBL const * gg);
+
   virtual ~IntegState();
+
+ private:
+  /// Common end of both nextStep() versions.
+  /**
+   * \param coord Position-velocity just computed;
+   * \param norm Norm of the 4-velocity at coord.
+   */
+  int endStep(double const *coord, double norm);
 };
 
 #endif